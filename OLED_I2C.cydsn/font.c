@@ -1,482 +1,437 @@
+//======================================
+// fonts in GRAM format (generated by
+// host/font2page, do not edit: run
+// "make -C host fonts")
+//======================================
 #include "font.h"
 
-const font_t font = {.width = 12, .height = 16, .characters =
-{
-    {
+//======================================
+// 12x16 font, every character 12 pixels wide
+//======================================
+static const uint8 fontWidths[95] = {
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+};
+
+static const uint16 fontOffsets[95] = {
+    0, 24, 48, 72, 96, 120, 144, 168, 192, 216, 240, 264,
+    288, 312, 336, 360, 384, 408, 432, 456, 480, 504, 528, 552,
+    576, 600, 624, 648, 672, 696, 720, 744, 768, 792, 816, 840,
+    864, 888, 912, 936, 960, 984, 1008, 1032, 1056, 1080, 1104, 1128,
+    1152, 1176, 1200, 1224, 1248, 1272, 1296, 1320, 1344, 1368, 1392, 1416,
+    1440, 1464, 1488, 1512, 1536, 1560, 1584, 1608, 1632, 1656, 1680, 1704,
+    1728, 1752, 1776, 1800, 1824, 1848, 1872, 1896, 1920, 1944, 1968, 1992,
+    2016, 2040, 2064, 2088, 2112, 2136, 2160, 2184, 2208, 2232, 2256
+};
+
+static const uint8 fontBitmaps[2280] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // " " (space)
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "!"
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01,     // """
-    0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0xfe, 0x07,     // "#"
-    0xfe, 0x07, 0x98, 0x01, 0x98, 0x01, 0xfe, 0x07, 0xfe, 0x07, 0x98, 0x01,
-    0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0xf8, 0x03, 0xf8, 0x03, 0x66, 0x00,     // "$"
-    0x66, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x60, 0x06, 0x60, 0x06, 0xfc, 0x01,
-    0xfc, 0x01, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x1c, 0x06, 0x1c, 0x06, 0x9c, 0x01, 0x80, 0x01,     // "%"
-    0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x18, 0x00, 0x18, 0x00, 0x98, 0x03,
-    0x86, 0x03, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00 },
-    {
-    0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x86, 0x01, 0x86, 0x01, 0x66, 0x00,     // "&"
-    0x66, 0x00, 0x18, 0x00, 0x18, 0x00, 0x66, 0x06, 0x66, 0x06, 0x86, 0x01,
-    0x86, 0x01, 0x78, 0x06, 0x78, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "'"
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x18, 0x00,     // "("
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x60, 0x00, 0x60, 0x00, 0x80, 0x01,     // ")"
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00,
-    0x60, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x98, 0x01, 0x98, 0x01, 0x60, 0x00, 0x60, 0x00, 0x98, 0x01,     // "*"
-    0x98, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00,     // "+"
-    0x60, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,     // "!"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x00,     // """
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x60, 0xfe, 0xfe, 0x60, 0x60, 0xfe, 0xfe, 0x60, 0x60, 0x00,     // "#"
+    0x00, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x00,
+    0x00, 0x60, 0x60, 0x98, 0x98, 0xfe, 0xfe, 0x98, 0x98, 0x18, 0x00, 0x00,     // "$"
+    0x00, 0x00, 0x18, 0x19, 0x19, 0x7f, 0x7f, 0x19, 0x19, 0x06, 0x06, 0x00,
+    0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x80, 0x80, 0x70, 0x70, 0x0c, 0x0c, 0x00,     // "%"
+    0x00, 0x30, 0x30, 0x0e, 0x0e, 0x01, 0x01, 0x38, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x78, 0x78, 0x86, 0x86, 0x66, 0x66, 0x18, 0x18, 0x00, 0x00, 0x00,     // "&"
+    0x00, 0x1e, 0x1e, 0x61, 0x61, 0x66, 0x66, 0x18, 0x18, 0x66, 0x66, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,     // "'"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0xe0, 0x18, 0x18, 0x06, 0x06, 0x00, 0x00, 0x00,     // "("
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x18, 0x18, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x06, 0x18, 0x18, 0xe0, 0xe0, 0x00, 0x00, 0x00,     // ")"
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x66, 0x18, 0x18, 0x66, 0x66, 0x00, 0x00, 0x00,     // "*"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x80, 0xf0, 0xf0, 0x80, 0x80, 0x80, 0x00, 0x00,     // "+"
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // ","
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0xc0, 0x00,
-    0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "-"
-    0x00, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,     // "-"
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "."
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x0e, 0x0e, 0x00, 0x00,     // "/"
+    0x00, 0x00, 0x70, 0x70, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xf8, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0xf8, 0xf8, 0x00,     // "0"
+    0x00, 0x1f, 0x1f, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x18, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,     // "1"
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x7f, 0x7f, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x18, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x78, 0x78, 0x00,     // "2"
+    0x00, 0x60, 0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x00,
+    0x00, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x9e, 0x9e, 0x06, 0x06, 0x00,     // "3"
+    0x00, 0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x1e, 0x1e, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0xfe, 0xfe, 0x00, 0x00, 0x00,     // "4"
+    0x00, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x00,
+    0x00, 0x7e, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x86, 0x86, 0x00,     // "5"
+    0x00, 0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0xe0, 0xe0, 0x98, 0x98, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00,     // "6"
+    0x00, 0x1f, 0x1f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00,
+    0x00, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0x1e, 0x1e, 0x00,     // "7"
+    0x00, 0x00, 0x00, 0x7e, 0x7e, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00,     // "8"
+    0x00, 0x1e, 0x1e, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00,
+    0x00, 0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0xf8, 0xf8, 0x00,     // "9"
+    0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x19, 0x19, 0x07, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,     // ":"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,     // ";"
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0x00, 0x00, 0x00,     // "<"
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x06, 0x06, 0x18, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,     // "="
+    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0x00,     // ">"
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x06, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x18, 0x18, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x78, 0x78, 0x00,     // "?"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xf8, 0x06, 0xe6, 0xe6, 0x66, 0x46, 0x66, 0xf8, 0xf8, 0x00,     // "@"
+    0x00, 0x1f, 0x7f, 0x60, 0x67, 0x67, 0x66, 0x66, 0x6c, 0x0f, 0x0f, 0x00,
+    0x00, 0xf8, 0xf8, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0xf8, 0xf8, 0x00,     // "A"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x7f, 0x00,
+    0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00,     // "B"
+    0x00, 0x7f, 0x7f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00,
+    0x00, 0xf8, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x18, 0x18, 0x00,     // "C"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x18, 0x18, 0x00,
+    0x00, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf8, 0xf8, 0x00,     // "D"
+    0x00, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00,     // "E"
+    0x00, 0x7f, 0x7f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x00,
+    0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00,     // "F"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xf8, 0x06, 0x06, 0x86, 0x86, 0x86, 0x86, 0x98, 0x98, 0x00,     // "G"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x1f, 0x1f, 0x00,
+    0x00, 0xfe, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0xfe, 0x00,     // "H"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x7f, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x00, 0x00,     // "I"
+    0x00, 0x00, 0x60, 0x60, 0x60, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x00,     // "J"
+    0x00, 0x18, 0x18, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0x06, 0x06, 0x00,     // "K"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x06, 0x06, 0x18, 0x18, 0x60, 0x60, 0x00,
+    0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "L"
+    0x00, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00,
+    0x00, 0xfe, 0xfe, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0xfe, 0xfe, 0x00,     // "M"
+    0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00,
+    0x00, 0xfe, 0xfe, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0xfe, 0xfe, 0x00,     // "N"
+    0x00, 0x7f, 0x7f, 0x00, 0x00, 0x01, 0x01, 0x06, 0x06, 0x7f, 0x7f, 0x00,
+    0x00, 0xf8, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf8, 0xf8, 0x00,     // "O"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00,     // "P"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf8, 0xf8, 0x00,     // "Q"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x66, 0x66, 0x18, 0x18, 0x67, 0x67, 0x00,
+    0x00, 0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00,     // "R"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7e, 0x7e, 0x00,
+    0x00, 0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00,     // "S"
+    0x00, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00,
+    0x00, 0x06, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00,     // "T"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00,     // "U"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00,     // "V"
+    0x00, 0x07, 0x07, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x00,
+    0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00,     // "W"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x1c, 0x1c, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0x1e, 0x1e, 0x60, 0x60, 0x80, 0x80, 0x60, 0x60, 0x1e, 0x1e, 0x00,     // "X"
+    0x00, 0x78, 0x78, 0x06, 0x06, 0x01, 0x01, 0x06, 0x06, 0x78, 0x78, 0x00,
+    0x00, 0x7e, 0x7e, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x7e, 0x7e, 0x00,     // "Y"
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x7e, 0x7e, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0x1e, 0x1e, 0x00,     // "Z"
+    0x00, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,     // "["
+    0x00, 0x00, 0x00, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0x0e, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "\"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x70, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x00, 0x00, 0x00,     // "]"
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x7f, 0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x06, 0x06, 0x18, 0x18, 0x00, 0x00, 0x00,     // "^"
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00 },
-    {    
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xc0, 0x00, 0xc0, 0x00,     // "/"
-    0xc0, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
-    0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x86, 0x07,     // "0"
-    0x86, 0x07, 0x66, 0x06, 0x66, 0x06, 0x1e, 0x06, 0x1e, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x78, 0x00, 0x78, 0x00, 0x60, 0x00,     // "1"
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x00, 0x06,     // "2"
-    0x00, 0x06, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x00 },
-    {
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00,     // "3"
-    0x60, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x06, 0x00, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0x98, 0x01,     // "4"
-    0x98, 0x01, 0x86, 0x01, 0x86, 0x01, 0xfe, 0x07, 0xfe, 0x07, 0x80, 0x01,
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x06, 0x00, 0x06, 0x00, 0xfe, 0x01,     // "5"
-    0xfe, 0x01, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0x18, 0x00, 0x18, 0x00, 0x06, 0x00,     // "6"
-    0x06, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x06, 0x00, 0x06, 0x80, 0x01,     // "7"
-    0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "8"
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "9"
-    0x06, 0x06, 0xf8, 0x07, 0xf8, 0x07, 0x00, 0x06, 0x00, 0x06, 0x80, 0x01,
-    0x80, 0x01, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,     // ":"
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,     // ";"
-    0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00,     // "<"
-    0x60, 0x00, 0x18, 0x00, 0x18, 0x00, 0x60, 0x00, 0x60, 0x00, 0x80, 0x01,
-    0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03,     // "="
-    0xfc, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x60, 0x00,     // "<"
-    0x60, 0x00, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x00, 0x06,     // "?"
-    0x00, 0x06, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x76, 0x07,     // "@"
-    0xf6, 0x07, 0x36, 0x06, 0x36, 0x06, 0xf6, 0x06, 0xf6, 0x07, 0x06, 0x07,
-    0x06, 0x00, 0xfc, 0x01, 0xfc, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "A"
-    0x06, 0x06, 0xfe, 0x07, 0xfe, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "B"
-    0x06, 0x06, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xfe, 0x01, 0xfe, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00,     // "C"
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "D"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xfe, 0x01, 0xfe, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,     // "E"
-    0x06, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,     // "F"
-    0x06, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00,     // "G" 
-    0x06, 0x00, 0xe6, 0x07, 0xe6, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "H"
-    0x06, 0x06, 0xfe, 0x07, 0xfe, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "I"
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0xfc, 0x03, 0xfc, 0x03, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x07, 0xf8, 0x07, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,     // "J"
-    0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc6, 0x00,
-    0xc6, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x86, 0x01, 0x86, 0x01, 0x66, 0x00,     // "K"
-    0x66, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x66, 0x00, 0x66, 0x00, 0x86, 0x01,
-    0x86, 0x01, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,     // "L"
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x9e, 0x07, 0x9e, 0x07, 0x66, 0x06,     // "M"
-    0x66, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1e, 0x06,     // "N"
-    0x1e, 0x06, 0x66, 0x06, 0x66, 0x06, 0x86, 0x07, 0x86, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "O"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "P"
-    0x06, 0x06, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "Q"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x66, 0x06, 0x66, 0x06, 0x86, 0x01,
-    0x86, 0x01, 0x78, 0x06, 0x78, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "R"
-    0x06, 0x06, 0xfe, 0x01, 0xfe, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x07, 0xf8, 0x07, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,     // "S"
-    0x06, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
-    0x00, 0x06, 0xfe, 0x01, 0xfe, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "T"
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "U"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "V"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x98, 0x01,
-    0x98, 0x01, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "W"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x66, 0x06, 0x66, 0x06,
-    0x66, 0x06, 0x98, 0x01, 0x98, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x98, 0x01,     // "X"
-    0x98, 0x01, 0x60, 0x00, 0x60, 0x00, 0x98, 0x01, 0x98, 0x01, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,     // "Y"
-    0x06, 0x06, 0x98, 0x01, 0x98, 0x01, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x06, 0x00, 0x06, 0x80, 0x01,     // "Z"
-    0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x18, 0x00, 0x18, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,     // "["
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x30, 0x00,     // "\"
-    0x30, 0x00, 0x30, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,     // "]"
-    0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
-    0x80, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x98, 0x01, 0x98, 0x01, 0x00, 0x00,     // "^"
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "_"
+    0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,     // "`"
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00,     // "`"
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01,     // "a"
-    0xf8, 0x01, 0x00, 0x06, 0x00, 0x06, 0xf8, 0x07, 0xf8, 0x07, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x07, 0xf8, 0x07, 0x00, 0x00
-    },
-    {
-    0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xe6, 0x01,     // "b"
-    0xe6, 0x01, 0x1e, 0x06, 0x1e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xfe, 0x01, 0xfe, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01,     // "c"
-    0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x06, 0x00, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x78, 0x06,     // "d"
-    0x78, 0x06, 0x86, 0x07, 0x86, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x07, 0xf8, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01,     // "e"
-    0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0xfe, 0x07, 0xfe, 0x07, 0x06, 0x00,
-    0x06, 0x00, 0xf8, 0x07, 0xf8, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0xe0, 0x01, 0xe0, 0x01, 0x18, 0x06, 0x18, 0x06, 0x18, 0x00,     // "f"
-    0x18, 0x00, 0xfe, 0x01, 0xfe, 0x01, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x06,     // "g"
-    0xf8, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06, 0xf8, 0x07, 0xf8, 0x07,
-    0x00, 0x06, 0xf8, 0x07, 0xf8, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,     // "h"
-    0x06, 0x00, 0xe6, 0x01, 0xe6, 0x01, 0x1e, 0x06, 0x1e, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,     // "i"
-    0x78, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00
-    },
-    {
-    0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,     // "j"
-    0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x0c, 0x03,
-    0x0c, 0x03, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00
-    },
-    {
-    0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x03,     // "k"
-    0x06, 0x03, 0xc6, 0x00, 0xc6, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0xc6, 0x00,
-    0xc6, 0x00, 0x06, 0x03, 0x06, 0x03, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "l"
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x01,     // "m"
-    0x9e, 0x01, 0x66, 0x06, 0x66, 0x06, 0x66, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x01,     // "n"
-    0xe6, 0x01, 0x1e, 0x06, 0x1e, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01,     // "o"
-    0xf8, 0x01, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
-    0x06, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x01,     // "p"
-    0xf6, 0x01, 0x0e, 0x06, 0x0e, 0x06, 0x06, 0x06, 0xfe, 0x01, 0xfe, 0x01,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x06,     // "q"
-    0xf8, 0x06, 0x06, 0x07, 0x06, 0x07, 0x06, 0x06, 0xf8, 0x07, 0xf8, 0x07,
-    0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0x01,     // "r"
-    0xe6, 0x01, 0x1e, 0x06, 0x1e, 0x06, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,
-    0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x03,     // "s"
-    0xf8, 0x03, 0x06, 0x00, 0x06, 0x00, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x06,
-    0x00, 0x06, 0xfc, 0x01, 0xfc, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x7e, 0x00,     // "t"
-    0x7e, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x06,
-    0x18, 0x06, 0xe0, 0x01, 0xe0, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,     // "u"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x86, 0x07,
-    0x86, 0x07, 0x78, 0x06, 0x78, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,     // "v"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x98, 0x01,
-    0x98, 0x01, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,     // "w"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x66, 0x06, 0x66, 0x06,
-    0x66, 0x06, 0x98, 0x01, 0x98, 0x01, 0x00, 0x00
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,     // "x"
-    0x06, 0x06, 0x98, 0x01, 0x98, 0x01, 0x60, 0x00, 0x60, 0x00, 0x98, 0x01,
-    0x98, 0x01, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,     // "y"
-    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf8, 0x07, 0xf8, 0x07, 0x00, 0x06,
-    0x00, 0x06, 0xf8, 0x01, 0xf8, 0x01, 0x00, 0x00
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x07,     // "z" 
-    0xfe, 0x07, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x18, 0x00,
-    0x18, 0x00, 0xfe, 0x07, 0xfe, 0x07, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "{"
-    0x60, 0x00, 0x18, 0x00, 0x18, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "|"
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,     // "}"
-    0x60, 0x00, 0x80, 0x01, 0x80, 0x01, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x60, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00 
-    },
-    {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "~"
-    0x38, 0x06, 0x38, 0x06, 0xc6, 0x01, 0xc6, 0x01, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 
-    }
-}
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "a"
+    0x00, 0x18, 0x18, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0x7f, 0x00,
+    0x00, 0xfe, 0xfe, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "b"
+    0x00, 0x7f, 0x7f, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "c"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x19, 0x19, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0xfe, 0xfe, 0x00,     // "d"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x7f, 0x7f, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "e"
+    0x00, 0x1f, 0x1f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x00,
+    0x00, 0x80, 0x80, 0xf8, 0xf8, 0x86, 0x86, 0x86, 0x86, 0x18, 0x18, 0x00,     // "f"
+    0x00, 0x01, 0x01, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xe0, 0xe0, 0x00,     // "g"
+    0x00, 0x03, 0x03, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x7f, 0x7f, 0x00,
+    0x00, 0xfe, 0xfe, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,     // "h"
+    0x00, 0x7f, 0x7f, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x7e, 0x7e, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x60, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00,     // "i"
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x7f, 0x7f, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0x00, 0x00,     // "j"
+    0x00, 0x00, 0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x80, 0x80, 0x60, 0x60, 0x00, 0x00,     // "k"
+    0x00, 0x7f, 0x7f, 0x06, 0x06, 0x06, 0x19, 0x19, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x06, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,     // "l"
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x7f, 0x7f, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0xe0, 0x60, 0x60, 0x80, 0x80, 0x60, 0x60, 0x80, 0x80, 0x00,     // "m"
+    0x00, 0x7f, 0x7f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x7f, 0x7f, 0x00,
+    0x00, 0xe0, 0xe0, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "n"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "o"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0xe0, 0xe0, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "p"
+    0x00, 0x7f, 0x7f, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0x03, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xe0, 0xe0, 0x00,     // "q"
+    0x00, 0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x7f, 0x7f, 0x00,
+    0x00, 0xe0, 0xe0, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00,     // "r"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,     // "s"
+    0x00, 0x01, 0x61, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x18, 0x00,
+    0x00, 0x60, 0x60, 0xf8, 0xf8, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,     // "t"
+    0x00, 0x00, 0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x18, 0x18, 0x00,
+    0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00,     // "u"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x18, 0x18, 0x7f, 0x7f, 0x00,
+    0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00,     // "v"
+    0x00, 0x07, 0x07, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x00,
+    0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00,     // "w"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x1c, 0x1c, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x60, 0x60, 0x00,     // "x"
+    0x00, 0x60, 0x60, 0x19, 0x19, 0x06, 0x06, 0x19, 0x19, 0x60, 0x60, 0x00,
+    0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00,     // "y"
+    0x00, 0x01, 0x01, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x1f, 0x1f, 0x00,
+    0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xe0, 0x60, 0x60, 0x00,     // "z"
+    0x00, 0x60, 0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x78, 0x78, 0x06, 0x06, 0x00, 0x00, 0x00,     // "{"
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x1e, 0x1e, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,     // "|"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x06, 0x78, 0x78, 0x80, 0x80, 0x00, 0x00, 0x00,     // "}"
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x1e, 0x1e, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00,     // "~"
+    0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00
 };
 
+const font_t font = {.encoding = FONT_RAW, .height = 16, .first = ' ', .last = '~', .widths = fontWidths, .offsets = fontOffsets, .bitmaps = fontBitmaps};
+
+//======================================
+// 12x16 font, proportional
+//======================================
+static const uint8 fontPropWidths[95] = {
+    6, 4, 8, 12, 12, 12, 12, 4, 8, 8, 8, 10, 6, 10, 4, 10,
+    12, 8, 12, 12, 12, 12, 12, 12, 12, 12, 4, 6, 8, 10, 8, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 8, 8, 12,
+    6, 12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 11, 8, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 4, 8, 12
+};
+
+static const uint16 fontPropOffsets[95] = {
+    0, 12, 20, 36, 60, 84, 108, 132, 140, 156, 172, 188,
+    208, 220, 240, 248, 268, 292, 308, 332, 356, 380, 404, 428,
+    452, 476, 500, 508, 520, 536, 556, 572, 596, 620, 644, 668,
+    692, 716, 740, 764, 788, 812, 832, 856, 880, 904, 928, 952,
+    976, 1000, 1024, 1048, 1072, 1096, 1120, 1144, 1168, 1192, 1216, 1240,
+    1256, 1276, 1292, 1308, 1332, 1344, 1368, 1392, 1416, 1440, 1464, 1488,
+    1512, 1536, 1552, 1572, 1594, 1610, 1634, 1658, 1682, 1706, 1730, 1754,
+    1778, 1802, 1826, 1850, 1874, 1898, 1922, 1946, 1962, 1970, 1986
+};
+
+static const uint8 fontPropBitmaps[2010] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // " " (space)
+    0xfe, 0xfe, 0x00, 0x00, 0x67, 0x67, 0x00, 0x00,                             // "!"
+    0x7e, 0x7e, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // """
+    0x00, 0x00, 0x00, 0x00,
+    0x60, 0x60, 0xfe, 0xfe, 0x60, 0x60, 0xfe, 0xfe, 0x60, 0x60, 0x00, 0x00,     // "#"
+    0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x00, 0x00,
+    0x60, 0x60, 0x98, 0x98, 0xfe, 0xfe, 0x98, 0x98, 0x18, 0x00, 0x00, 0x00,     // "$"
+    0x00, 0x18, 0x19, 0x19, 0x7f, 0x7f, 0x19, 0x19, 0x06, 0x06, 0x00, 0x00,
+    0x00, 0x1c, 0x1c, 0x1c, 0x80, 0x80, 0x70, 0x70, 0x0c, 0x0c, 0x00, 0x00,     // "%"
+    0x30, 0x30, 0x0e, 0x0e, 0x01, 0x01, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00,
+    0x78, 0x78, 0x86, 0x86, 0x66, 0x66, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00,     // "&"
+    0x1e, 0x1e, 0x61, 0x61, 0x66, 0x66, 0x18, 0x18, 0x66, 0x66, 0x00, 0x00,
+    0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                             // "'"
+    0xe0, 0xe0, 0x18, 0x18, 0x06, 0x06, 0x00, 0x00, 0x07, 0x07, 0x18, 0x18,     // "("
+    0x60, 0x60, 0x00, 0x00,
+    0x06, 0x06, 0x18, 0x18, 0xe0, 0xe0, 0x00, 0x00, 0x60, 0x60, 0x18, 0x18,     // ")"
+    0x07, 0x07, 0x00, 0x00,
+    0x66, 0x66, 0x18, 0x18, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "*"
+    0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x80, 0xf0, 0xf0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01,     // "+"
+    0x01, 0x0f, 0x0f, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x1c, 0x1c, 0x00, 0x00,     // ","
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01,     // "-"
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00,                             // "."
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x0e, 0x0e, 0x00, 0x00, 0x70, 0x70,     // "/"
+    0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0xf8, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0xf8, 0xf8, 0x00, 0x00,     // "0"
+    0x1f, 0x1f, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0x18, 0x18, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x7f, 0x7f,     // "1"
+    0x60, 0x60, 0x00, 0x00,
+    0x18, 0x18, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x78, 0x78, 0x00, 0x00,     // "2"
+    0x60, 0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x9e, 0x9e, 0x06, 0x06, 0x00, 0x00,     // "3"
+    0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x1e, 0x1e, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00,     // "4"
+    0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x00, 0x00,
+    0x7e, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x86, 0x86, 0x00, 0x00,     // "5"
+    0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0xe0, 0xe0, 0x98, 0x98, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x00,     // "6"
+    0x1f, 0x1f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0x1e, 0x1e, 0x00, 0x00,     // "7"
+    0x00, 0x00, 0x7e, 0x7e, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00, 0x00,     // "8"
+    0x1e, 0x1e, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00, 0x00,
+    0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0xf8, 0xf8, 0x00, 0x00,     // "9"
+    0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x19, 0x19, 0x07, 0x07, 0x00, 0x00,
+    0x60, 0x60, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00,                             // ":"
+    0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x30, 0x30, 0x0e, 0x0e, 0x00, 0x00,     // ";"
+    0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0x00, 0x00, 0x01, 0x01, 0x06, 0x06,     // "<"
+    0x18, 0x18, 0x00, 0x00,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x06, 0x06,     // "="
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00,
+    0x18, 0x18, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0x18, 0x18, 0x06, 0x06,     // ">"
+    0x01, 0x01, 0x00, 0x00,
+    0x18, 0x18, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x78, 0x78, 0x00, 0x00,     // "?"
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0xf8, 0x06, 0xe6, 0xe6, 0x66, 0x46, 0x66, 0xf8, 0xf8, 0x00, 0x00,     // "@"
+    0x1f, 0x7f, 0x60, 0x67, 0x67, 0x66, 0x66, 0x6c, 0x0f, 0x0f, 0x00, 0x00,
+    0xf8, 0xf8, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0xf8, 0xf8, 0x00, 0x00,     // "A"
+    0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x7f, 0x00, 0x00,
+    0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00, 0x00,     // "B"
+    0x7f, 0x7f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00, 0x00,
+    0xf8, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x18, 0x18, 0x00, 0x00,     // "C"
+    0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x18, 0x18, 0x00, 0x00,
+    0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf8, 0xf8, 0x00, 0x00,     // "D"
+    0x7f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00, 0x00,     // "E"
+    0x7f, 0x7f, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x00, 0x00,
+    0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00, 0x00,     // "F"
+    0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0xf8, 0x06, 0x06, 0x86, 0x86, 0x86, 0x86, 0x98, 0x98, 0x00, 0x00,     // "G"
+    0x1f, 0x1f, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x1f, 0x1f, 0x00, 0x00,
+    0xfe, 0xfe, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xfe, 0xfe, 0x00, 0x00,     // "H"
+    0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7f, 0x7f, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x00, 0x00, 0x60, 0x60,     // "I"
+    0x60, 0x7f, 0x7f, 0x60, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x00, 0x00,     // "J"
+    0x18, 0x18, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0xfe, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0x06, 0x06, 0x00, 0x00,     // "K"
+    0x7f, 0x7f, 0x01, 0x01, 0x06, 0x06, 0x18, 0x18, 0x60, 0x60, 0x00, 0x00,
+    0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "L"
+    0x7f, 0x7f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,
+    0xfe, 0xfe, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0xfe, 0xfe, 0x00, 0x00,     // "M"
+    0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00,
+    0xfe, 0xfe, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00,     // "N"
+    0x7f, 0x7f, 0x00, 0x00, 0x01, 0x01, 0x06, 0x06, 0x7f, 0x7f, 0x00, 0x00,
+    0xf8, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf8, 0xf8, 0x00, 0x00,     // "O"
+    0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00, 0x00,     // "P"
+    0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xf8, 0xf8, 0x00, 0x00,     // "Q"
+    0x1f, 0x1f, 0x60, 0x60, 0x66, 0x66, 0x18, 0x18, 0x67, 0x67, 0x00, 0x00,
+    0xfe, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78, 0x00, 0x00,     // "R"
+    0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7e, 0x7e, 0x00, 0x00,
+    0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00, 0x00,     // "S"
+    0x60, 0x60, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1e, 0x1e, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00,     // "T"
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00,     // "U"
+    0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00,     // "V"
+    0x07, 0x07, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x00, 0x00,
+    0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00,     // "W"
+    0x1f, 0x1f, 0x60, 0x60, 0x1c, 0x1c, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0x1e, 0x1e, 0x60, 0x60, 0x80, 0x80, 0x60, 0x60, 0x1e, 0x1e, 0x00, 0x00,     // "X"
+    0x78, 0x78, 0x06, 0x06, 0x01, 0x01, 0x06, 0x06, 0x78, 0x78, 0x00, 0x00,
+    0x7e, 0x7e, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x7e, 0x7e, 0x00, 0x00,     // "Y"
+    0x00, 0x00, 0x01, 0x01, 0x7e, 0x7e, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0x1e, 0x1e, 0x00, 0x00,     // "Z"
+    0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,
+    0xfe, 0xfe, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x7f, 0x7f, 0x60, 0x60,     // "["
+    0x60, 0x60, 0x00, 0x00,
+    0x0e, 0x0e, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "\"
+    0x00, 0x00, 0x0f, 0x0f, 0x70, 0x70, 0x00, 0x00,
+    0x06, 0x06, 0x06, 0x06, 0xfe, 0xfe, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60,     // "]"
+    0x7f, 0x7f, 0x00, 0x00,
+    0x18, 0x18, 0x06, 0x06, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "^"
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "_"
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00,
+    0x06, 0x06, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "`"
+    0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "a"
+    0x18, 0x18, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7f, 0x7f, 0x00, 0x00,
+    0xfe, 0xfe, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "b"
+    0x7f, 0x7f, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "c"
+    0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x19, 0x19, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0xfe, 0xfe, 0x00, 0x00,     // "d"
+    0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x7f, 0x7f, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "e"
+    0x1f, 0x1f, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x00, 0x00,
+    0x80, 0x80, 0xf8, 0xf8, 0x86, 0x86, 0x86, 0x86, 0x18, 0x18, 0x00, 0x00,     // "f"
+    0x01, 0x01, 0x7f, 0x7f, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xe0, 0xe0, 0x00, 0x00,     // "g"
+    0x03, 0x03, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x7f, 0x7f, 0x00, 0x00,
+    0xfe, 0xfe, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,     // "h"
+    0x7f, 0x7f, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x7e, 0x7e, 0x00, 0x00,
+    0x60, 0x60, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x7f, 0x7f,     // "i"
+    0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0x00, 0x00, 0x18, 0x18,     // "j"
+    0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0xfe, 0xfe, 0x00, 0x00, 0x00, 0x80, 0x80, 0x60, 0x60, 0x00, 0x00, 0x7f,     // "k"
+    0x7f, 0x06, 0x06, 0x06, 0x19, 0x19, 0x60, 0x60, 0x00, 0x00,
+    0x06, 0x06, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x7f, 0x7f,     // "l"
+    0x60, 0x60, 0x00, 0x00,
+    0xe0, 0xe0, 0x60, 0x60, 0x80, 0x80, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "m"
+    0x7f, 0x7f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00,
+    0xe0, 0xe0, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "n"
+    0x7f, 0x7f, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "o"
+    0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0xe0, 0xe0, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "p"
+    0x7f, 0x7f, 0x0d, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x03, 0x03, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x80, 0xe0, 0xe0, 0x00, 0x00,     // "q"
+    0x03, 0x03, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0d, 0x7f, 0x7f, 0x00, 0x00,
+    0xe0, 0xe0, 0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00,     // "r"
+    0x7f, 0x7f, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+    0x80, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00,     // "s"
+    0x01, 0x61, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x18, 0x18, 0x00, 0x00,
+    0x60, 0x60, 0xf8, 0xf8, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "t"
+    0x00, 0x00, 0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x18, 0x18, 0x00, 0x00,
+    0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00,     // "u"
+    0x1f, 0x1f, 0x60, 0x60, 0x60, 0x60, 0x18, 0x18, 0x7f, 0x7f, 0x00, 0x00,
+    0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00,     // "v"
+    0x07, 0x07, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x00, 0x00,
+    0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00,     // "w"
+    0x1f, 0x1f, 0x60, 0x60, 0x1c, 0x1c, 0x60, 0x60, 0x1f, 0x1f, 0x00, 0x00,
+    0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x60, 0x60, 0x00, 0x00,     // "x"
+    0x60, 0x60, 0x19, 0x19, 0x06, 0x06, 0x19, 0x19, 0x60, 0x60, 0x00, 0x00,
+    0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00,     // "y"
+    0x01, 0x01, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x1f, 0x1f, 0x00, 0x00,
+    0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xe0, 0x60, 0x60, 0x00, 0x00,     // "z"
+    0x60, 0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x00, 0x00,
+    0x80, 0x80, 0x78, 0x78, 0x06, 0x06, 0x00, 0x00, 0x01, 0x01, 0x1e, 0x1e,     // "{"
+    0x60, 0x60, 0x00, 0x00,
+    0xfe, 0xfe, 0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00,                             // "|"
+    0x06, 0x06, 0x78, 0x78, 0x80, 0x80, 0x00, 0x00, 0x60, 0x60, 0x1e, 0x1e,     // "}"
+    0x01, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00,     // "~"
+    0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00
+};
+
+const font_t fontProp = {.encoding = FONT_RAW, .height = 16, .first = ' ', .last = '~', .widths = fontPropWidths, .offsets = fontPropOffsets, .bitmaps = fontPropBitmaps};
+
 //========================================
 // END OF FILE
 //========================================
@@ -10,12 +10,41 @@
 // font struct                  
 //======================================
 typedef struct {
-    const uint8 width;
-    const uint8 height;
-    const uint8 characters[95][32];
+    const uint8 encoding;               // how bitmaps is stored (FONT_RAW or FONT_RLE)
+    const uint8 height;                 // height of the characters (in pixels)
+    const uint8 first;                  // first character of the font (e.g. ' ')
+    const uint8 last;                   // last character of the font (e.g. '~')
+    const uint8 * widths;               // width of each character (in pixels), which is also how far the next character is moved to the right
+    const uint16 * offsets;             // offset of each character in bitmaps
+    const uint8 * bitmaps;              // characters in GRAM format (see oled_DispPageBitmap()): (height+7)/8 pages of width bytes each, compressed one by one for FONT_RLE
 } font_t;
 
-const extern font_t font;
+//======================================
+// font encodings
+//======================================
+#define FONT_RAW 0                      // characters stored as they are copied into GRAM
+#define FONT_RLE 1                      // each character compressed like the bitmaps of oled_DispRLEBitmap()
+
+//======================================
+// fonts (font.c, generated by host/font2page)
+//======================================
+const extern font_t font;               // 12x16, every character 12 pixels wide
+const extern font_t fontProp;           // 12x16, each character as wide as its pixels plus 2 pixels of spacing
+
+//======================================
+// font family (font_family.c, generated by
+// host/font2page from the same characters
+// scaled to each size). Fonts that are not
+// used are dropped by the linker
+//======================================
+const extern font_t font6x8;            // 6x8, every character 6 pixels wide (21 characters per line)
+const extern font_t font6x8Prop;        // 6x8, each character as wide as its pixels plus 1 pixel of spacing
+const extern font_t font6x8RLE;         // font6x8, compressed
+const extern font_t font8x16;           // 8x16, every character 8 pixels wide
+const extern font_t font8x16RLE;        // font8x16, compressed
+const extern font_t font12x16RLE;       // font, compressed
+const extern font_t font16x24;          // 16x24, every character 16 pixels wide
+const extern font_t font16x24RLE;       // font16x24, compressed
 
 #endif
 
@@ -0,0 +1,1684 @@
+//======================================
+// fonts in GRAM format (generated by
+// host/font2page, do not edit: run
+// "make -C host fonts")
+//======================================
+#include "font.h"
+
+//======================================
+// 6x8 font, every character 6 pixels wide
+//======================================
+static const uint8 font6x8Widths[95] = {
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6
+};
+
+static const uint16 font6x8Offsets[95] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66,
+    72, 78, 84, 90, 96, 102, 108, 114, 120, 126, 132, 138,
+    144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210,
+    216, 222, 228, 234, 240, 246, 252, 258, 264, 270, 276, 282,
+    288, 294, 300, 306, 312, 318, 324, 330, 336, 342, 348, 354,
+    360, 366, 372, 378, 384, 390, 396, 402, 408, 414, 420, 426,
+    432, 438, 444, 450, 456, 462, 468, 474, 480, 486, 492, 498,
+    504, 510, 516, 522, 528, 534, 540, 546, 552, 558, 564
+};
+
+static const uint8 font6x8Bitmaps[570] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                                         // " " (space)
+    0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,                                         // "!"
+    0x00, 0x07, 0x00, 0x07, 0x00, 0x00,                                         // """
+    0x14, 0x7f, 0x14, 0x7f, 0x14, 0x00,                                         // "#"
+    0x04, 0x2a, 0x7f, 0x2a, 0x12, 0x00,                                         // "$"
+    0x40, 0x32, 0x08, 0x64, 0x62, 0x00,                                         // "%"
+    0x36, 0x49, 0x55, 0x22, 0x50, 0x00,                                         // "&"
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x00,                                         // "'"
+    0x00, 0x1c, 0x22, 0x41, 0x00, 0x00,                                         // "("
+    0x00, 0x41, 0x22, 0x1c, 0x00, 0x00,                                         // ")"
+    0x00, 0x05, 0x02, 0x05, 0x00, 0x00,                                         // "*"
+    0x00, 0x08, 0x3c, 0x08, 0x08, 0x00,                                         // "+"
+    0x00, 0x00, 0x40, 0x20, 0x00, 0x00,                                         // ","
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x00,                                         // "-"
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00,                                         // "."
+    0x00, 0x40, 0x30, 0x0c, 0x03, 0x00,                                         // "/"
+    0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00,                                         // "0"
+    0x00, 0x42, 0x7f, 0x40, 0x00, 0x00,                                         // "1"
+    0x42, 0x61, 0x51, 0x49, 0x46, 0x00,                                         // "2"
+    0x21, 0x41, 0x45, 0x4b, 0x31, 0x00,                                         // "3"
+    0x18, 0x14, 0x12, 0x7f, 0x10, 0x00,                                         // "4"
+    0x27, 0x45, 0x45, 0x45, 0x39, 0x00,                                         // "5"
+    0x3c, 0x4a, 0x49, 0x49, 0x30, 0x00,                                         // "6"
+    0x01, 0x71, 0x09, 0x05, 0x03, 0x00,                                         // "7"
+    0x36, 0x49, 0x49, 0x49, 0x36, 0x00,                                         // "8"
+    0x06, 0x49, 0x49, 0x29, 0x1e, 0x00,                                         // "9"
+    0x00, 0x00, 0x14, 0x00, 0x00, 0x00,                                         // ":"
+    0x00, 0x40, 0x34, 0x00, 0x00, 0x00,                                         // ";"
+    0x00, 0x08, 0x14, 0x22, 0x00, 0x00,                                         // "<"
+    0x00, 0x14, 0x14, 0x14, 0x14, 0x00,                                         // "="
+    0x00, 0x22, 0x14, 0x08, 0x00, 0x00,                                         // ">"
+    0x02, 0x01, 0x51, 0x09, 0x06, 0x00,                                         // "?"
+    0x3e, 0x41, 0x5d, 0x51, 0x3e, 0x00,                                         // "@"
+    0x7e, 0x09, 0x09, 0x09, 0x7e, 0x00,                                         // "A"
+    0x7f, 0x49, 0x49, 0x49, 0x36, 0x00,                                         // "B"
+    0x3e, 0x41, 0x41, 0x41, 0x22, 0x00,                                         // "C"
+    0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00,                                         // "D"
+    0x7f, 0x49, 0x49, 0x49, 0x41, 0x00,                                         // "E"
+    0x7f, 0x09, 0x09, 0x09, 0x01, 0x00,                                         // "F"
+    0x3e, 0x41, 0x49, 0x49, 0x3a, 0x00,                                         // "G"
+    0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00,                                         // "H"
+    0x00, 0x41, 0x7f, 0x41, 0x41, 0x00,                                         // "I"
+    0x20, 0x41, 0x41, 0x3f, 0x01, 0x00,                                         // "J"
+    0x7f, 0x08, 0x14, 0x22, 0x41, 0x00,                                         // "K"
+    0x7f, 0x40, 0x40, 0x40, 0x40, 0x00,                                         // "L"
+    0x7f, 0x02, 0x04, 0x02, 0x7f, 0x00,                                         // "M"
+    0x7f, 0x04, 0x08, 0x10, 0x7f, 0x00,                                         // "N"
+    0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00,                                         // "O"
+    0x7f, 0x09, 0x09, 0x09, 0x06, 0x00,                                         // "P"
+    0x3e, 0x41, 0x51, 0x21, 0x5e, 0x00,                                         // "Q"
+    0x7f, 0x09, 0x09, 0x09, 0x76, 0x00,                                         // "R"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00,                                         // "S"
+    0x01, 0x01, 0x7f, 0x01, 0x01, 0x00,                                         // "T"
+    0x3f, 0x40, 0x40, 0x40, 0x3f, 0x00,                                         // "U"
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00,                                         // "V"
+    0x3f, 0x40, 0x20, 0x40, 0x3f, 0x00,                                         // "W"
+    0x63, 0x14, 0x08, 0x14, 0x63, 0x00,                                         // "X"
+    0x07, 0x08, 0x70, 0x08, 0x07, 0x00,                                         // "Y"
+    0x61, 0x51, 0x49, 0x45, 0x43, 0x00,                                         // "Z"
+    0x00, 0x7f, 0x41, 0x41, 0x00, 0x00,                                         // "["
+    0x00, 0x03, 0x0c, 0x30, 0x40, 0x00,                                         // "\"
+    0x00, 0x41, 0x41, 0x7f, 0x00, 0x00,                                         // "]"
+    0x00, 0x02, 0x01, 0x02, 0x00, 0x00,                                         // "^"
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00,                                         // "_"
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x00,                                         // "`"
+    0x20, 0x54, 0x54, 0x54, 0x78, 0x00,                                         // "a"
+    0x7f, 0x48, 0x44, 0x44, 0x38, 0x00,                                         // "b"
+    0x38, 0x44, 0x44, 0x44, 0x28, 0x00,                                         // "c"
+    0x38, 0x44, 0x44, 0x48, 0x7f, 0x00,                                         // "d"
+    0x38, 0x54, 0x54, 0x54, 0x58, 0x00,                                         // "e"
+    0x08, 0x7e, 0x09, 0x09, 0x02, 0x00,                                         // "f"
+    0x18, 0x64, 0x64, 0x64, 0x7c, 0x00,                                         // "g"
+    0x7f, 0x10, 0x08, 0x08, 0x70, 0x00,                                         // "h"
+    0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,                                         // "i"
+    0x00, 0x20, 0x40, 0x40, 0x3d, 0x00,                                         // "j"
+    0x7f, 0x10, 0x10, 0x28, 0x44, 0x00,                                         // "k"
+    0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,                                         // "l"
+    0x7c, 0x04, 0x18, 0x04, 0x78, 0x00,                                         // "m"
+    0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,                                         // "n"
+    0x38, 0x44, 0x44, 0x44, 0x38, 0x00,                                         // "o"
+    0x7c, 0x28, 0x24, 0x24, 0x18, 0x00,                                         // "p"
+    0x18, 0x24, 0x24, 0x24, 0x7c, 0x00,                                         // "q"
+    0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,                                         // "r"
+    0x08, 0x54, 0x54, 0x54, 0x24, 0x00,                                         // "s"
+    0x04, 0x3e, 0x44, 0x40, 0x20, 0x00,                                         // "t"
+    0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,                                         // "u"
+    0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00,                                         // "v"
+    0x3c, 0x40, 0x20, 0x40, 0x3c, 0x00,                                         // "w"
+    0x44, 0x28, 0x10, 0x28, 0x44, 0x00,                                         // "x"
+    0x0c, 0x50, 0x50, 0x50, 0x3c, 0x00,                                         // "y"
+    0x44, 0x64, 0x54, 0x4c, 0x44, 0x00,                                         // "z"
+    0x00, 0x08, 0x36, 0x41, 0x00, 0x00,                                         // "{"
+    0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,                                         // "|"
+    0x00, 0x41, 0x36, 0x08, 0x00, 0x00,                                         // "}"
+    0x10, 0x08, 0x08, 0x10, 0x08, 0x00                                         // "~"
+};
+
+const font_t font6x8 = {.encoding = FONT_RAW, .height = 8, .first = ' ', .last = '~', .widths = font6x8Widths, .offsets = font6x8Offsets, .bitmaps = font6x8Bitmaps};
+
+//======================================
+// 6x8 font, proportional
+//======================================
+static const uint8 font6x8PropWidths[95] = {
+    3, 2, 4, 6, 6, 6, 6, 2, 4, 4, 4, 5, 3, 5, 2, 5,
+    6, 4, 6, 6, 6, 6, 6, 6, 6, 6, 2, 3, 4, 5, 4, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 5, 4, 4, 6,
+    3, 6, 6, 6, 6, 6, 6, 6, 6, 4, 5, 6, 4, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 2, 4, 6
+};
+
+static const uint16 font6x8PropOffsets[95] = {
+    0, 3, 5, 9, 15, 21, 27, 33, 35, 39, 43, 47,
+    52, 55, 60, 62, 67, 73, 77, 83, 89, 95, 101, 107,
+    113, 119, 125, 127, 130, 134, 139, 143, 149, 155, 161, 167,
+    173, 179, 185, 191, 197, 203, 208, 214, 220, 226, 232, 238,
+    244, 250, 256, 262, 268, 274, 280, 286, 292, 298, 304, 310,
+    314, 319, 323, 327, 333, 336, 342, 348, 354, 360, 366, 372,
+    378, 384, 388, 393, 399, 403, 409, 415, 421, 427, 433, 439,
+    445, 451, 457, 463, 469, 475, 481, 487, 491, 493, 497
+};
+
+static const uint8 font6x8PropBitmaps[503] = {
+    0x00, 0x00, 0x00,                                                           // " " (space)
+    0x5f, 0x00,                                                                 // "!"
+    0x07, 0x00, 0x07, 0x00,                                                     // """
+    0x14, 0x7f, 0x14, 0x7f, 0x14, 0x00,                                         // "#"
+    0x04, 0x2a, 0x7f, 0x2a, 0x12, 0x00,                                         // "$"
+    0x40, 0x32, 0x08, 0x64, 0x62, 0x00,                                         // "%"
+    0x36, 0x49, 0x55, 0x22, 0x50, 0x00,                                         // "&"
+    0x07, 0x00,                                                                 // "'"
+    0x1c, 0x22, 0x41, 0x00,                                                     // "("
+    0x41, 0x22, 0x1c, 0x00,                                                     // ")"
+    0x05, 0x02, 0x05, 0x00,                                                     // "*"
+    0x08, 0x3c, 0x08, 0x08, 0x00,                                               // "+"
+    0x40, 0x20, 0x00,                                                           // ","
+    0x08, 0x08, 0x08, 0x08, 0x00,                                               // "-"
+    0x40, 0x00,                                                                 // "."
+    0x40, 0x30, 0x0c, 0x03, 0x00,                                               // "/"
+    0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00,                                         // "0"
+    0x42, 0x7f, 0x40, 0x00,                                                     // "1"
+    0x42, 0x61, 0x51, 0x49, 0x46, 0x00,                                         // "2"
+    0x21, 0x41, 0x45, 0x4b, 0x31, 0x00,                                         // "3"
+    0x18, 0x14, 0x12, 0x7f, 0x10, 0x00,                                         // "4"
+    0x27, 0x45, 0x45, 0x45, 0x39, 0x00,                                         // "5"
+    0x3c, 0x4a, 0x49, 0x49, 0x30, 0x00,                                         // "6"
+    0x01, 0x71, 0x09, 0x05, 0x03, 0x00,                                         // "7"
+    0x36, 0x49, 0x49, 0x49, 0x36, 0x00,                                         // "8"
+    0x06, 0x49, 0x49, 0x29, 0x1e, 0x00,                                         // "9"
+    0x14, 0x00,                                                                 // ":"
+    0x40, 0x34, 0x00,                                                           // ";"
+    0x08, 0x14, 0x22, 0x00,                                                     // "<"
+    0x14, 0x14, 0x14, 0x14, 0x00,                                               // "="
+    0x22, 0x14, 0x08, 0x00,                                                     // ">"
+    0x02, 0x01, 0x51, 0x09, 0x06, 0x00,                                         // "?"
+    0x3e, 0x41, 0x5d, 0x51, 0x3e, 0x00,                                         // "@"
+    0x7e, 0x09, 0x09, 0x09, 0x7e, 0x00,                                         // "A"
+    0x7f, 0x49, 0x49, 0x49, 0x36, 0x00,                                         // "B"
+    0x3e, 0x41, 0x41, 0x41, 0x22, 0x00,                                         // "C"
+    0x7f, 0x41, 0x41, 0x41, 0x3e, 0x00,                                         // "D"
+    0x7f, 0x49, 0x49, 0x49, 0x41, 0x00,                                         // "E"
+    0x7f, 0x09, 0x09, 0x09, 0x01, 0x00,                                         // "F"
+    0x3e, 0x41, 0x49, 0x49, 0x3a, 0x00,                                         // "G"
+    0x7f, 0x08, 0x08, 0x08, 0x7f, 0x00,                                         // "H"
+    0x41, 0x7f, 0x41, 0x41, 0x00,                                               // "I"
+    0x20, 0x41, 0x41, 0x3f, 0x01, 0x00,                                         // "J"
+    0x7f, 0x08, 0x14, 0x22, 0x41, 0x00,                                         // "K"
+    0x7f, 0x40, 0x40, 0x40, 0x40, 0x00,                                         // "L"
+    0x7f, 0x02, 0x04, 0x02, 0x7f, 0x00,                                         // "M"
+    0x7f, 0x04, 0x08, 0x10, 0x7f, 0x00,                                         // "N"
+    0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00,                                         // "O"
+    0x7f, 0x09, 0x09, 0x09, 0x06, 0x00,                                         // "P"
+    0x3e, 0x41, 0x51, 0x21, 0x5e, 0x00,                                         // "Q"
+    0x7f, 0x09, 0x09, 0x09, 0x76, 0x00,                                         // "R"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00,                                         // "S"
+    0x01, 0x01, 0x7f, 0x01, 0x01, 0x00,                                         // "T"
+    0x3f, 0x40, 0x40, 0x40, 0x3f, 0x00,                                         // "U"
+    0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00,                                         // "V"
+    0x3f, 0x40, 0x20, 0x40, 0x3f, 0x00,                                         // "W"
+    0x63, 0x14, 0x08, 0x14, 0x63, 0x00,                                         // "X"
+    0x07, 0x08, 0x70, 0x08, 0x07, 0x00,                                         // "Y"
+    0x61, 0x51, 0x49, 0x45, 0x43, 0x00,                                         // "Z"
+    0x7f, 0x41, 0x41, 0x00,                                                     // "["
+    0x03, 0x0c, 0x30, 0x40, 0x00,                                               // "\"
+    0x41, 0x41, 0x7f, 0x00,                                                     // "]"
+    0x02, 0x01, 0x02, 0x00,                                                     // "^"
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x00,                                         // "_"
+    0x01, 0x02, 0x00,                                                           // "`"
+    0x20, 0x54, 0x54, 0x54, 0x78, 0x00,                                         // "a"
+    0x7f, 0x48, 0x44, 0x44, 0x38, 0x00,                                         // "b"
+    0x38, 0x44, 0x44, 0x44, 0x28, 0x00,                                         // "c"
+    0x38, 0x44, 0x44, 0x48, 0x7f, 0x00,                                         // "d"
+    0x38, 0x54, 0x54, 0x54, 0x58, 0x00,                                         // "e"
+    0x08, 0x7e, 0x09, 0x09, 0x02, 0x00,                                         // "f"
+    0x18, 0x64, 0x64, 0x64, 0x7c, 0x00,                                         // "g"
+    0x7f, 0x10, 0x08, 0x08, 0x70, 0x00,                                         // "h"
+    0x44, 0x7d, 0x40, 0x00,                                                     // "i"
+    0x20, 0x40, 0x40, 0x3d, 0x00,                                               // "j"
+    0x7f, 0x10, 0x10, 0x28, 0x44, 0x00,                                         // "k"
+    0x41, 0x7f, 0x40, 0x00,                                                     // "l"
+    0x7c, 0x04, 0x18, 0x04, 0x78, 0x00,                                         // "m"
+    0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,                                         // "n"
+    0x38, 0x44, 0x44, 0x44, 0x38, 0x00,                                         // "o"
+    0x7c, 0x28, 0x24, 0x24, 0x18, 0x00,                                         // "p"
+    0x18, 0x24, 0x24, 0x24, 0x7c, 0x00,                                         // "q"
+    0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,                                         // "r"
+    0x08, 0x54, 0x54, 0x54, 0x24, 0x00,                                         // "s"
+    0x04, 0x3e, 0x44, 0x40, 0x20, 0x00,                                         // "t"
+    0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,                                         // "u"
+    0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00,                                         // "v"
+    0x3c, 0x40, 0x20, 0x40, 0x3c, 0x00,                                         // "w"
+    0x44, 0x28, 0x10, 0x28, 0x44, 0x00,                                         // "x"
+    0x0c, 0x50, 0x50, 0x50, 0x3c, 0x00,                                         // "y"
+    0x44, 0x64, 0x54, 0x4c, 0x44, 0x00,                                         // "z"
+    0x08, 0x36, 0x41, 0x00,                                                     // "{"
+    0x7f, 0x00,                                                                 // "|"
+    0x41, 0x36, 0x08, 0x00,                                                     // "}"
+    0x10, 0x08, 0x08, 0x10, 0x08, 0x00                                         // "~"
+};
+
+const font_t font6x8Prop = {.encoding = FONT_RAW, .height = 8, .first = ' ', .last = '~', .widths = font6x8PropWidths, .offsets = font6x8PropOffsets, .bitmaps = font6x8PropBitmaps};
+
+//======================================
+// 6x8 font, every character 6 pixels wide, compressed
+//======================================
+static const uint8 font6x8RLEWidths[95] = {
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6
+};
+
+static const uint16 font6x8RLEOffsets[95] = {
+    0, 2, 8, 15, 22, 29, 36, 43, 49, 56, 63, 70,
+    77, 84, 90, 96, 103, 110, 117, 124, 131, 138, 145, 152,
+    159, 166, 173, 179, 185, 192, 198, 205, 212, 219, 226, 233,
+    240, 247, 254, 261, 268, 275, 282, 289, 296, 302, 309, 316,
+    323, 330, 337, 344, 351, 358, 365, 372, 379, 386, 393, 400,
+    407, 414, 421, 428, 432, 439, 446, 453, 460, 467, 474, 481,
+    488, 495, 502, 509, 516, 523, 530, 537, 544, 551, 558, 565,
+    572, 579, 586, 593, 600, 607, 614, 621, 628, 634, 641
+};
+
+static const uint8 font6x8RLEBitmaps[648] = {
+    0x84, 0x00,                                                                 // " " (space)
+    0x02, 0x00, 0x00, 0x5f, 0x81, 0x00,                                         // "!"
+    0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00,                                   // """
+    0x05, 0x14, 0x7f, 0x14, 0x7f, 0x14, 0x00,                                   // "#"
+    0x05, 0x04, 0x2a, 0x7f, 0x2a, 0x12, 0x00,                                   // "$"
+    0x05, 0x40, 0x32, 0x08, 0x64, 0x62, 0x00,                                   // "%"
+    0x05, 0x36, 0x49, 0x55, 0x22, 0x50, 0x00,                                   // "&"
+    0x02, 0x00, 0x00, 0x07, 0x81, 0x00,                                         // "'"
+    0x05, 0x00, 0x1c, 0x22, 0x41, 0x00, 0x00,                                   // "("
+    0x05, 0x00, 0x41, 0x22, 0x1c, 0x00, 0x00,                                   // ")"
+    0x05, 0x00, 0x05, 0x02, 0x05, 0x00, 0x00,                                   // "*"
+    0x05, 0x00, 0x08, 0x3c, 0x08, 0x08, 0x00,                                   // "+"
+    0x05, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00,                                   // ","
+    0x00, 0x00, 0x82, 0x08, 0x00, 0x00,                                         // "-"
+    0x02, 0x00, 0x00, 0x40, 0x81, 0x00,                                         // "."
+    0x05, 0x00, 0x40, 0x30, 0x0c, 0x03, 0x00,                                   // "/"
+    0x05, 0x3e, 0x51, 0x49, 0x45, 0x3e, 0x00,                                   // "0"
+    0x05, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00,                                   // "1"
+    0x05, 0x42, 0x61, 0x51, 0x49, 0x46, 0x00,                                   // "2"
+    0x05, 0x21, 0x41, 0x45, 0x4b, 0x31, 0x00,                                   // "3"
+    0x05, 0x18, 0x14, 0x12, 0x7f, 0x10, 0x00,                                   // "4"
+    0x00, 0x27, 0x81, 0x45, 0x01, 0x39, 0x00,                                   // "5"
+    0x05, 0x3c, 0x4a, 0x49, 0x49, 0x30, 0x00,                                   // "6"
+    0x05, 0x01, 0x71, 0x09, 0x05, 0x03, 0x00,                                   // "7"
+    0x00, 0x36, 0x81, 0x49, 0x01, 0x36, 0x00,                                   // "8"
+    0x05, 0x06, 0x49, 0x49, 0x29, 0x1e, 0x00,                                   // "9"
+    0x02, 0x00, 0x00, 0x14, 0x81, 0x00,                                         // ":"
+    0x02, 0x00, 0x40, 0x34, 0x81, 0x00,                                         // ";"
+    0x05, 0x00, 0x08, 0x14, 0x22, 0x00, 0x00,                                   // "<"
+    0x00, 0x00, 0x82, 0x14, 0x00, 0x00,                                         // "="
+    0x05, 0x00, 0x22, 0x14, 0x08, 0x00, 0x00,                                   // ">"
+    0x05, 0x02, 0x01, 0x51, 0x09, 0x06, 0x00,                                   // "?"
+    0x05, 0x3e, 0x41, 0x5d, 0x51, 0x3e, 0x00,                                   // "@"
+    0x00, 0x7e, 0x81, 0x09, 0x01, 0x7e, 0x00,                                   // "A"
+    0x00, 0x7f, 0x81, 0x49, 0x01, 0x36, 0x00,                                   // "B"
+    0x00, 0x3e, 0x81, 0x41, 0x01, 0x22, 0x00,                                   // "C"
+    0x00, 0x7f, 0x81, 0x41, 0x01, 0x3e, 0x00,                                   // "D"
+    0x00, 0x7f, 0x81, 0x49, 0x01, 0x41, 0x00,                                   // "E"
+    0x00, 0x7f, 0x81, 0x09, 0x01, 0x01, 0x00,                                   // "F"
+    0x05, 0x3e, 0x41, 0x49, 0x49, 0x3a, 0x00,                                   // "G"
+    0x00, 0x7f, 0x81, 0x08, 0x01, 0x7f, 0x00,                                   // "H"
+    0x05, 0x00, 0x41, 0x7f, 0x41, 0x41, 0x00,                                   // "I"
+    0x05, 0x20, 0x41, 0x41, 0x3f, 0x01, 0x00,                                   // "J"
+    0x05, 0x7f, 0x08, 0x14, 0x22, 0x41, 0x00,                                   // "K"
+    0x00, 0x7f, 0x82, 0x40, 0x00, 0x00,                                         // "L"
+    0x05, 0x7f, 0x02, 0x04, 0x02, 0x7f, 0x00,                                   // "M"
+    0x05, 0x7f, 0x04, 0x08, 0x10, 0x7f, 0x00,                                   // "N"
+    0x00, 0x3e, 0x81, 0x41, 0x01, 0x3e, 0x00,                                   // "O"
+    0x00, 0x7f, 0x81, 0x09, 0x01, 0x06, 0x00,                                   // "P"
+    0x05, 0x3e, 0x41, 0x51, 0x21, 0x5e, 0x00,                                   // "Q"
+    0x00, 0x7f, 0x81, 0x09, 0x01, 0x76, 0x00,                                   // "R"
+    0x00, 0x46, 0x81, 0x49, 0x01, 0x31, 0x00,                                   // "S"
+    0x05, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x00,                                   // "T"
+    0x00, 0x3f, 0x81, 0x40, 0x01, 0x3f, 0x00,                                   // "U"
+    0x05, 0x1f, 0x20, 0x40, 0x20, 0x1f, 0x00,                                   // "V"
+    0x05, 0x3f, 0x40, 0x20, 0x40, 0x3f, 0x00,                                   // "W"
+    0x05, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00,                                   // "X"
+    0x05, 0x07, 0x08, 0x70, 0x08, 0x07, 0x00,                                   // "Y"
+    0x05, 0x61, 0x51, 0x49, 0x45, 0x43, 0x00,                                   // "Z"
+    0x05, 0x00, 0x7f, 0x41, 0x41, 0x00, 0x00,                                   // "["
+    0x05, 0x00, 0x03, 0x0c, 0x30, 0x40, 0x00,                                   // "\"
+    0x05, 0x00, 0x41, 0x41, 0x7f, 0x00, 0x00,                                   // "]"
+    0x05, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00,                                   // "^"
+    0x83, 0x40, 0x00, 0x00,                                                     // "_"
+    0x05, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,                                   // "`"
+    0x00, 0x20, 0x81, 0x54, 0x01, 0x78, 0x00,                                   // "a"
+    0x05, 0x7f, 0x48, 0x44, 0x44, 0x38, 0x00,                                   // "b"
+    0x00, 0x38, 0x81, 0x44, 0x01, 0x28, 0x00,                                   // "c"
+    0x05, 0x38, 0x44, 0x44, 0x48, 0x7f, 0x00,                                   // "d"
+    0x00, 0x38, 0x81, 0x54, 0x01, 0x58, 0x00,                                   // "e"
+    0x05, 0x08, 0x7e, 0x09, 0x09, 0x02, 0x00,                                   // "f"
+    0x00, 0x18, 0x81, 0x64, 0x01, 0x7c, 0x00,                                   // "g"
+    0x05, 0x7f, 0x10, 0x08, 0x08, 0x70, 0x00,                                   // "h"
+    0x05, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00,                                   // "i"
+    0x05, 0x00, 0x20, 0x40, 0x40, 0x3d, 0x00,                                   // "j"
+    0x05, 0x7f, 0x10, 0x10, 0x28, 0x44, 0x00,                                   // "k"
+    0x05, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00,                                   // "l"
+    0x05, 0x7c, 0x04, 0x18, 0x04, 0x78, 0x00,                                   // "m"
+    0x05, 0x7c, 0x08, 0x04, 0x04, 0x78, 0x00,                                   // "n"
+    0x00, 0x38, 0x81, 0x44, 0x01, 0x38, 0x00,                                   // "o"
+    0x05, 0x7c, 0x28, 0x24, 0x24, 0x18, 0x00,                                   // "p"
+    0x00, 0x18, 0x81, 0x24, 0x01, 0x7c, 0x00,                                   // "q"
+    0x05, 0x7c, 0x08, 0x04, 0x04, 0x08, 0x00,                                   // "r"
+    0x00, 0x08, 0x81, 0x54, 0x01, 0x24, 0x00,                                   // "s"
+    0x05, 0x04, 0x3e, 0x44, 0x40, 0x20, 0x00,                                   // "t"
+    0x05, 0x3c, 0x40, 0x40, 0x20, 0x7c, 0x00,                                   // "u"
+    0x05, 0x1c, 0x20, 0x40, 0x20, 0x1c, 0x00,                                   // "v"
+    0x05, 0x3c, 0x40, 0x20, 0x40, 0x3c, 0x00,                                   // "w"
+    0x05, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00,                                   // "x"
+    0x00, 0x0c, 0x81, 0x50, 0x01, 0x3c, 0x00,                                   // "y"
+    0x05, 0x44, 0x64, 0x54, 0x4c, 0x44, 0x00,                                   // "z"
+    0x05, 0x00, 0x08, 0x36, 0x41, 0x00, 0x00,                                   // "{"
+    0x02, 0x00, 0x00, 0x7f, 0x81, 0x00,                                         // "|"
+    0x05, 0x00, 0x41, 0x36, 0x08, 0x00, 0x00,                                   // "}"
+    0x05, 0x10, 0x08, 0x08, 0x10, 0x08, 0x00                                   // "~"
+};
+
+const font_t font6x8RLE = {.encoding = FONT_RLE, .height = 8, .first = ' ', .last = '~', .widths = font6x8RLEWidths, .offsets = font6x8RLEOffsets, .bitmaps = font6x8RLEBitmaps};
+
+//======================================
+// 8x16 font, every character 8 pixels wide
+//======================================
+static const uint8 font8x16Widths[95] = {
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8
+};
+
+static const uint16 font8x16Offsets[95] = {
+    0, 16, 32, 48, 64, 80, 96, 112, 128, 144, 160, 176,
+    192, 208, 224, 240, 256, 272, 288, 304, 320, 336, 352, 368,
+    384, 400, 416, 432, 448, 464, 480, 496, 512, 528, 544, 560,
+    576, 592, 608, 624, 640, 656, 672, 688, 704, 720, 736, 752,
+    768, 784, 800, 816, 832, 848, 864, 880, 896, 912, 928, 944,
+    960, 976, 992, 1008, 1024, 1040, 1056, 1072, 1088, 1104, 1120, 1136,
+    1152, 1168, 1184, 1200, 1216, 1232, 1248, 1264, 1280, 1296, 1312, 1328,
+    1344, 1360, 1376, 1392, 1408, 1424, 1440, 1456, 1472, 1488, 1504
+};
+
+static const uint8 font8x16Bitmaps[1520] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // " " (space)
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67,     // "!"
+    0x67, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // """
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0xfe, 0x60, 0x60, 0xfe, 0x60, 0x00, 0x00, 0x06, 0x7f, 0x06,     // "#"
+    0x06, 0x7f, 0x06, 0x00,
+    0x00, 0x60, 0x98, 0xfe, 0xfe, 0x98, 0x18, 0x00, 0x00, 0x18, 0x19, 0x7f,     // "$"
+    0x7f, 0x19, 0x06, 0x00,
+    0x00, 0x1c, 0x1c, 0x80, 0x80, 0x70, 0x0c, 0x00, 0x00, 0x30, 0x0e, 0x01,     // "%"
+    0x01, 0x38, 0x38, 0x00,
+    0x00, 0x78, 0x86, 0x66, 0x66, 0x18, 0x00, 0x00, 0x00, 0x1e, 0x61, 0x66,     // "&"
+    0x66, 0x18, 0x66, 0x00,
+    0x00, 0x00, 0x00, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "'"
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xe0, 0x18, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x18,     // "("
+    0x18, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x18, 0x18, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18,     // ")"
+    0x18, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x66, 0x18, 0x18, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "*"
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0xf0, 0xf0, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x0f,     // "+"
+    0x0f, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,     // ","
+    0x1c, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x01,     // "-"
+    0x01, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,     // "."
+    0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x0e, 0x0e, 0x00, 0x00, 0x70, 0x70, 0x0f,     // "/"
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x06, 0x86, 0x86, 0x66, 0xf8, 0x00, 0x00, 0x1f, 0x66, 0x61,     // "0"
+    0x61, 0x60, 0x1f, 0x00,
+    0x00, 0x00, 0x18, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7f,     // "1"
+    0x7f, 0x60, 0x00, 0x00,
+    0x00, 0x18, 0x06, 0x06, 0x06, 0x86, 0x78, 0x00, 0x00, 0x60, 0x78, 0x66,     // "2"
+    0x66, 0x61, 0x60, 0x00,
+    0x00, 0x06, 0x06, 0x66, 0x66, 0x9e, 0x06, 0x00, 0x00, 0x18, 0x60, 0x60,     // "3"
+    0x60, 0x61, 0x1e, 0x00,
+    0x00, 0x80, 0x60, 0x18, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x07, 0x06, 0x06,     // "4"
+    0x06, 0x7f, 0x06, 0x00,
+    0x00, 0x7e, 0x66, 0x66, 0x66, 0x66, 0x86, 0x00, 0x00, 0x18, 0x60, 0x60,     // "5"
+    0x60, 0x60, 0x1f, 0x00,
+    0x00, 0xe0, 0x98, 0x86, 0x86, 0x86, 0x00, 0x00, 0x00, 0x1f, 0x61, 0x61,     // "6"
+    0x61, 0x61, 0x1e, 0x00,
+    0x00, 0x06, 0x06, 0x86, 0x86, 0x66, 0x1e, 0x00, 0x00, 0x00, 0x7e, 0x01,     // "7"
+    0x01, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x86, 0x86, 0x86, 0x86, 0x78, 0x00, 0x00, 0x1e, 0x61, 0x61,     // "8"
+    0x61, 0x61, 0x1e, 0x00,
+    0x00, 0x78, 0x86, 0x86, 0x86, 0x86, 0xf8, 0x00, 0x00, 0x00, 0x61, 0x61,     // "9"
+    0x61, 0x19, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,     // ":"
+    0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0e,     // ";"
+    0x0e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x60, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06,     // "<"
+    0x06, 0x18, 0x00, 0x00,
+    0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x06, 0x06, 0x06,     // "="
+    0x06, 0x06, 0x06, 0x00,
+    0x00, 0x00, 0x18, 0x60, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00, 0x18, 0x06,     // ">"
+    0x06, 0x01, 0x00, 0x00,
+    0x00, 0x18, 0x06, 0x06, 0x06, 0x86, 0x78, 0x00, 0x00, 0x00, 0x00, 0x66,     // "?"
+    0x66, 0x01, 0x00, 0x00,
+    0x00, 0xf8, 0x06, 0xe6, 0x66, 0x66, 0xf8, 0x00, 0x00, 0x7f, 0x60, 0x67,     // "@"
+    0x66, 0x6c, 0x0f, 0x00,
+    0x00, 0xf8, 0x86, 0x86, 0x86, 0x86, 0xf8, 0x00, 0x00, 0x7f, 0x01, 0x01,     // "A"
+    0x01, 0x01, 0x7f, 0x00,
+    0x00, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x78, 0x00, 0x00, 0x7f, 0x61, 0x61,     // "B"
+    0x61, 0x61, 0x1e, 0x00,
+    0x00, 0xf8, 0x06, 0x06, 0x06, 0x06, 0x18, 0x00, 0x00, 0x1f, 0x60, 0x60,     // "C"
+    0x60, 0x60, 0x18, 0x00,
+    0x00, 0xfe, 0x06, 0x06, 0x06, 0x06, 0xf8, 0x00, 0x00, 0x7f, 0x60, 0x60,     // "D"
+    0x60, 0x60, 0x1f, 0x00,
+    0x00, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00, 0x7f, 0x61, 0x61,     // "E"
+    0x61, 0x61, 0x60, 0x00,
+    0x00, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00, 0x7f, 0x01, 0x01,     // "F"
+    0x01, 0x01, 0x00, 0x00,
+    0x00, 0xf8, 0x06, 0x86, 0x86, 0x86, 0x98, 0x00, 0x00, 0x1f, 0x60, 0x61,     // "G"
+    0x61, 0x61, 0x1f, 0x00,
+    0x00, 0xfe, 0x80, 0x80, 0x80, 0x80, 0xfe, 0x00, 0x00, 0x7f, 0x01, 0x01,     // "H"
+    0x01, 0x01, 0x7f, 0x00,
+    0x00, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x60, 0x60, 0x7f,     // "I"
+    0x7f, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x18, 0x60, 0x60,     // "J"
+    0x1f, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0x80, 0x60, 0x60, 0x18, 0x06, 0x00, 0x00, 0x7f, 0x01, 0x06,     // "K"
+    0x06, 0x18, 0x60, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x60, 0x60,     // "L"
+    0x60, 0x60, 0x60, 0x00,
+    0x00, 0xfe, 0x18, 0x60, 0x60, 0x18, 0xfe, 0x00, 0x00, 0x7f, 0x00, 0x00,     // "M"
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0xfe, 0x60, 0x80, 0x80, 0x00, 0xfe, 0x00, 0x00, 0x7f, 0x00, 0x01,     // "N"
+    0x01, 0x06, 0x7f, 0x00,
+    0x00, 0xf8, 0x06, 0x06, 0x06, 0x06, 0xf8, 0x00, 0x00, 0x1f, 0x60, 0x60,     // "O"
+    0x60, 0x60, 0x1f, 0x00,
+    0x00, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x78, 0x00, 0x00, 0x7f, 0x01, 0x01,     // "P"
+    0x01, 0x01, 0x00, 0x00,
+    0x00, 0xf8, 0x06, 0x06, 0x06, 0x06, 0xf8, 0x00, 0x00, 0x1f, 0x60, 0x66,     // "Q"
+    0x66, 0x18, 0x67, 0x00,
+    0x00, 0xfe, 0x86, 0x86, 0x86, 0x86, 0x78, 0x00, 0x00, 0x7f, 0x01, 0x01,     // "R"
+    0x01, 0x01, 0x7e, 0x00,
+    0x00, 0x78, 0x86, 0x86, 0x86, 0x86, 0x06, 0x00, 0x00, 0x60, 0x61, 0x61,     // "S"
+    0x61, 0x61, 0x1e, 0x00,
+    0x00, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x7f,     // "T"
+    0x7f, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x1f, 0x60, 0x60,     // "U"
+    0x60, 0x60, 0x1f, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x07, 0x18, 0x60,     // "V"
+    0x60, 0x18, 0x07, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x1f, 0x60, 0x1c,     // "W"
+    0x1c, 0x60, 0x1f, 0x00,
+    0x00, 0x1e, 0x60, 0x80, 0x80, 0x60, 0x1e, 0x00, 0x00, 0x78, 0x06, 0x01,     // "X"
+    0x01, 0x06, 0x78, 0x00,
+    0x00, 0x7e, 0x80, 0x00, 0x00, 0x80, 0x7e, 0x00, 0x00, 0x00, 0x01, 0x7e,     // "Y"
+    0x7e, 0x01, 0x00, 0x00,
+    0x00, 0x06, 0x06, 0x86, 0x86, 0x66, 0x1e, 0x00, 0x00, 0x78, 0x66, 0x61,     // "Z"
+    0x61, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0xfe, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x60,     // "["
+    0x60, 0x60, 0x00, 0x00,
+    0x00, 0x0e, 0x0e, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "\"
+    0x0f, 0x70, 0x70, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x06, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60,     // "]"
+    0x60, 0x7f, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x06, 0x06, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "^"
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x60,     // "_"
+    0x60, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x06, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "`"
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x18, 0x66, 0x66,     // "a"
+    0x66, 0x66, 0x7f, 0x00,
+    0x00, 0xfe, 0x80, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x7f, 0x61, 0x60,     // "b"
+    0x60, 0x60, 0x1f, 0x00,
+    0x00, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x1f, 0x60, 0x60,     // "c"
+    0x60, 0x60, 0x19, 0x00,
+    0x00, 0x80, 0x60, 0x60, 0x60, 0x80, 0xfe, 0x00, 0x00, 0x1f, 0x60, 0x60,     // "d"
+    0x60, 0x61, 0x7f, 0x00,
+    0x00, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x1f, 0x66, 0x66,     // "e"
+    0x66, 0x66, 0x67, 0x00,
+    0x00, 0x80, 0xf8, 0x86, 0x86, 0x86, 0x18, 0x00, 0x00, 0x01, 0x7f, 0x01,     // "f"
+    0x01, 0x01, 0x00, 0x00,
+    0x00, 0x80, 0x60, 0x60, 0x60, 0x80, 0xe0, 0x00, 0x00, 0x03, 0x6c, 0x6c,     // "g"
+    0x6c, 0x6d, 0x7f, 0x00,
+    0x00, 0xfe, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x7f, 0x06, 0x01,     // "h"
+    0x01, 0x01, 0x7e, 0x00,
+    0x00, 0x00, 0x60, 0xe6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7f,     // "i"
+    0x7f, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xe6, 0x00, 0x00, 0x18, 0x18, 0x60,     // "j"
+    0x60, 0x1f, 0x1f, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0x80, 0x60, 0x60, 0x00, 0x00, 0x7f, 0x06, 0x06,     // "k"
+    0x19, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x06, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x7f,     // "l"
+    0x7f, 0x60, 0x00, 0x00,
+    0x00, 0xe0, 0x60, 0x80, 0x80, 0x60, 0x80, 0x00, 0x00, 0x7f, 0x00, 0x03,     // "m"
+    0x03, 0x00, 0x7f, 0x00,
+    0x00, 0xe0, 0x80, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x7f, 0x01, 0x00,     // "n"
+    0x00, 0x00, 0x7f, 0x00,
+    0x00, 0x80, 0x60, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x1f, 0x60, 0x60,     // "o"
+    0x60, 0x60, 0x1f, 0x00,
+    0x00, 0xe0, 0x80, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x7f, 0x0d, 0x0c,     // "p"
+    0x0c, 0x0c, 0x03, 0x00,
+    0x00, 0x80, 0x60, 0x60, 0x60, 0x80, 0xe0, 0x00, 0x00, 0x03, 0x0c, 0x0c,     // "q"
+    0x0c, 0x0d, 0x7f, 0x00,
+    0x00, 0xe0, 0x80, 0x60, 0x60, 0x60, 0x80, 0x00, 0x00, 0x7f, 0x01, 0x00,     // "r"
+    0x00, 0x00, 0x01, 0x00,
+    0x00, 0x80, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x61, 0x66, 0x66,     // "s"
+    0x66, 0x66, 0x18, 0x00,
+    0x00, 0x60, 0xf8, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x60,     // "t"
+    0x60, 0x60, 0x18, 0x00,
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x1f, 0x60, 0x60,     // "u"
+    0x60, 0x18, 0x7f, 0x00,
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x07, 0x18, 0x60,     // "v"
+    0x60, 0x18, 0x07, 0x00,
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x1f, 0x60, 0x1c,     // "w"
+    0x1c, 0x60, 0x1f, 0x00,
+    0x00, 0x60, 0x80, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x60, 0x19, 0x06,     // "x"
+    0x06, 0x19, 0x60, 0x00,
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x01, 0x66, 0x66,     // "y"
+    0x66, 0x66, 0x1f, 0x00,
+    0x00, 0x60, 0x60, 0x60, 0x60, 0xe0, 0x60, 0x00, 0x00, 0x60, 0x78, 0x66,     // "z"
+    0x66, 0x61, 0x60, 0x00,
+    0x00, 0x00, 0x80, 0x78, 0x78, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e,     // "{"
+    0x1e, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,     // "|"
+    0x7f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x78, 0x78, 0x80, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1e,     // "}"
+    0x1e, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00,     // "~"
+    0x03, 0x03, 0x00, 0x00
+};
+
+const font_t font8x16 = {.encoding = FONT_RAW, .height = 16, .first = ' ', .last = '~', .widths = font8x16Widths, .offsets = font8x16Offsets, .bitmaps = font8x16Bitmaps};
+
+//======================================
+// 8x16 font, every character 8 pixels wide, compressed
+//======================================
+static const uint8 font8x16RLEWidths[95] = {
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8
+};
+
+static const uint16 font8x16RLEOffsets[95] = {
+    0, 2, 14, 23, 40, 57, 74, 91, 98, 114, 130, 139,
+    156, 163, 174, 181, 194, 211, 226, 243, 260, 277, 292, 307,
+    323, 338, 353, 365, 378, 394, 405, 421, 437, 454, 469, 484,
+    499, 514, 529, 544, 561, 576, 593, 609, 626, 637, 653, 670,
+    685, 700, 716, 731, 746, 761, 776, 792, 808, 825, 842, 859,
+    874, 886, 901, 910, 916, 923, 938, 955, 970, 987, 1002, 1019,
+    1036, 1052, 1067, 1081, 1098, 1113, 1130, 1147, 1162, 1179, 1196, 1213,
+    1227, 1242, 1258, 1274, 1290, 1307, 1322, 1338, 1354, 1366, 1382
+};
+
+static const uint8 font8x16RLEBitmaps[1399] = {
+    0x8e, 0x00,                                                                 // " " (space)
+    0x81, 0x00, 0x01, 0xfe, 0xfe, 0x84, 0x00, 0x01, 0x67, 0x67, 0x81, 0x00,     // "!"
+    0x05, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x7e, 0x88, 0x00,                       // """
+    0x0f, 0x00, 0x60, 0xfe, 0x60, 0x60, 0xfe, 0x60, 0x00, 0x00, 0x06, 0x7f,     // "#"
+    0x06, 0x06, 0x7f, 0x06, 0x00,
+    0x0f, 0x00, 0x60, 0x98, 0xfe, 0xfe, 0x98, 0x18, 0x00, 0x00, 0x18, 0x19,     // "$"
+    0x7f, 0x7f, 0x19, 0x06, 0x00,
+    0x0f, 0x00, 0x1c, 0x1c, 0x80, 0x80, 0x70, 0x0c, 0x00, 0x00, 0x30, 0x0e,     // "%"
+    0x01, 0x01, 0x38, 0x38, 0x00,
+    0x05, 0x00, 0x78, 0x86, 0x66, 0x66, 0x18, 0x81, 0x00, 0x06, 0x1e, 0x61,     // "&"
+    0x66, 0x66, 0x18, 0x66, 0x00,
+    0x81, 0x00, 0x01, 0x7e, 0x7e, 0x89, 0x00,                                   // "'"
+    0x05, 0x00, 0x00, 0xe0, 0x18, 0x18, 0x06, 0x82, 0x00, 0x05, 0x07, 0x18,     // "("
+    0x18, 0x60, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x06, 0x18, 0x18, 0xe0, 0x82, 0x00, 0x05, 0x60, 0x18,     // ")"
+    0x18, 0x07, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x66, 0x18, 0x18, 0x66, 0x88, 0x00,                       // "*"
+    0x0f, 0x00, 0x80, 0x80, 0xf0, 0xf0, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01,     // "+"
+    0x0f, 0x0f, 0x01, 0x01, 0x00,
+    0x89, 0x00, 0x01, 0x60, 0x1c, 0x81, 0x00,                                   // ","
+    0x00, 0x00, 0x84, 0x80, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00,           // "-"
+    0x89, 0x00, 0x01, 0x30, 0x30, 0x81, 0x00,                                   // "."
+    0x82, 0x00, 0x07, 0xf0, 0x0e, 0x0e, 0x00, 0x00, 0x70, 0x70, 0x0f, 0x82,     // "/"
+    0x00,
+    0x0f, 0x00, 0xf8, 0x06, 0x86, 0x86, 0x66, 0xf8, 0x00, 0x00, 0x1f, 0x66,     // "0"
+    0x61, 0x61, 0x60, 0x1f, 0x00,
+    0x04, 0x00, 0x00, 0x18, 0xfe, 0xfe, 0x83, 0x00, 0x05, 0x60, 0x7f, 0x7f,     // "1"
+    0x60, 0x00, 0x00,
+    0x01, 0x00, 0x18, 0x81, 0x06, 0x0a, 0x86, 0x78, 0x00, 0x00, 0x60, 0x78,     // "2"
+    0x66, 0x66, 0x61, 0x60, 0x00,
+    0x09, 0x00, 0x06, 0x06, 0x66, 0x66, 0x9e, 0x06, 0x00, 0x00, 0x18, 0x81,     // "3"
+    0x60, 0x02, 0x61, 0x1e, 0x00,
+    0x05, 0x00, 0x80, 0x60, 0x18, 0x18, 0xfe, 0x81, 0x00, 0x00, 0x07, 0x81,     // "4"
+    0x06, 0x02, 0x7f, 0x06, 0x00,
+    0x01, 0x00, 0x7e, 0x82, 0x66, 0x03, 0x86, 0x00, 0x00, 0x18, 0x82, 0x60,     // "5"
+    0x01, 0x1f, 0x00,
+    0x02, 0x00, 0xe0, 0x98, 0x81, 0x86, 0x81, 0x00, 0x00, 0x1f, 0x82, 0x61,     // "6"
+    0x01, 0x1e, 0x00,
+    0x06, 0x00, 0x06, 0x06, 0x86, 0x86, 0x66, 0x1e, 0x81, 0x00, 0x02, 0x7e,     // "7"
+    0x01, 0x01, 0x81, 0x00,
+    0x01, 0x00, 0x78, 0x82, 0x86, 0x03, 0x78, 0x00, 0x00, 0x1e, 0x82, 0x61,     // "8"
+    0x01, 0x1e, 0x00,
+    0x01, 0x00, 0x78, 0x82, 0x86, 0x00, 0xf8, 0x81, 0x00, 0x81, 0x61, 0x02,     // "9"
+    0x19, 0x07, 0x00,
+    0x81, 0x00, 0x01, 0x60, 0x60, 0x84, 0x00, 0x01, 0x06, 0x06, 0x81, 0x00,     // ":"
+    0x81, 0x00, 0x01, 0x60, 0x60, 0x83, 0x00, 0x02, 0x30, 0x0e, 0x0e, 0x81,     // ";"
+    0x00,
+    0x05, 0x00, 0x00, 0x80, 0x60, 0x60, 0x18, 0x82, 0x00, 0x05, 0x01, 0x06,     // "<"
+    0x06, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x84, 0x60, 0x01, 0x00, 0x00, 0x84, 0x06, 0x00, 0x00,           // "="
+    0x05, 0x00, 0x00, 0x18, 0x60, 0x60, 0x80, 0x82, 0x00, 0x05, 0x18, 0x06,     // ">"
+    0x06, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x18, 0x81, 0x06, 0x01, 0x86, 0x78, 0x82, 0x00, 0x04, 0x66,     // "?"
+    0x66, 0x01, 0x00, 0x00,
+    0x0f, 0x00, 0xf8, 0x06, 0xe6, 0x66, 0x66, 0xf8, 0x00, 0x00, 0x7f, 0x60,     // "@"
+    0x67, 0x66, 0x6c, 0x0f, 0x00,
+    0x01, 0x00, 0xf8, 0x82, 0x86, 0x03, 0xf8, 0x00, 0x00, 0x7f, 0x82, 0x01,     // "A"
+    0x01, 0x7f, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x86, 0x03, 0x78, 0x00, 0x00, 0x7f, 0x82, 0x61,     // "B"
+    0x01, 0x1e, 0x00,
+    0x01, 0x00, 0xf8, 0x82, 0x06, 0x03, 0x18, 0x00, 0x00, 0x1f, 0x82, 0x60,     // "C"
+    0x01, 0x18, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x06, 0x03, 0xf8, 0x00, 0x00, 0x7f, 0x82, 0x60,     // "D"
+    0x01, 0x1f, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x86, 0x03, 0x06, 0x00, 0x00, 0x7f, 0x82, 0x61,     // "E"
+    0x01, 0x60, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x86, 0x03, 0x06, 0x00, 0x00, 0x7f, 0x82, 0x01,     // "F"
+    0x01, 0x00, 0x00,
+    0x02, 0x00, 0xf8, 0x06, 0x81, 0x86, 0x04, 0x98, 0x00, 0x00, 0x1f, 0x60,     // "G"
+    0x81, 0x61, 0x01, 0x1f, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x80, 0x03, 0xfe, 0x00, 0x00, 0x7f, 0x82, 0x01,     // "H"
+    0x01, 0x7f, 0x00,
+    0x0f, 0x00, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x60, 0x60,     // "I"
+    0x7f, 0x7f, 0x60, 0x60, 0x00,
+    0x0c, 0x00, 0x00, 0x06, 0x06, 0xfe, 0x06, 0x06, 0x00, 0x00, 0x18, 0x60,     // "J"
+    0x60, 0x1f, 0x81, 0x00,
+    0x0f, 0x00, 0xfe, 0x80, 0x60, 0x60, 0x18, 0x06, 0x00, 0x00, 0x7f, 0x01,     // "K"
+    0x06, 0x06, 0x18, 0x60, 0x00,
+    0x01, 0x00, 0xfe, 0x85, 0x00, 0x00, 0x7f, 0x83, 0x60, 0x00, 0x00,           // "L"
+    0x09, 0x00, 0xfe, 0x18, 0x60, 0x60, 0x18, 0xfe, 0x00, 0x00, 0x7f, 0x82,     // "M"
+    0x00, 0x01, 0x7f, 0x00,
+    0x0f, 0x00, 0xfe, 0x60, 0x80, 0x80, 0x00, 0xfe, 0x00, 0x00, 0x7f, 0x00,     // "N"
+    0x01, 0x01, 0x06, 0x7f, 0x00,
+    0x01, 0x00, 0xf8, 0x82, 0x06, 0x03, 0xf8, 0x00, 0x00, 0x1f, 0x82, 0x60,     // "O"
+    0x01, 0x1f, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x86, 0x03, 0x78, 0x00, 0x00, 0x7f, 0x82, 0x01,     // "P"
+    0x01, 0x00, 0x00,
+    0x01, 0x00, 0xf8, 0x82, 0x06, 0x09, 0xf8, 0x00, 0x00, 0x1f, 0x60, 0x66,     // "Q"
+    0x66, 0x18, 0x67, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x86, 0x03, 0x78, 0x00, 0x00, 0x7f, 0x82, 0x01,     // "R"
+    0x01, 0x7e, 0x00,
+    0x01, 0x00, 0x78, 0x82, 0x86, 0x03, 0x06, 0x00, 0x00, 0x60, 0x82, 0x61,     // "S"
+    0x01, 0x1e, 0x00,
+    0x06, 0x00, 0x06, 0x06, 0xfe, 0xfe, 0x06, 0x06, 0x82, 0x00, 0x01, 0x7f,     // "T"
+    0x7f, 0x81, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x1f, 0x82, 0x60,     // "U"
+    0x01, 0x1f, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x00, 0x09, 0xfe, 0x00, 0x00, 0x07, 0x18, 0x60,     // "V"
+    0x60, 0x18, 0x07, 0x00,
+    0x01, 0x00, 0xfe, 0x82, 0x00, 0x09, 0xfe, 0x00, 0x00, 0x1f, 0x60, 0x1c,     // "W"
+    0x1c, 0x60, 0x1f, 0x00,
+    0x0f, 0x00, 0x1e, 0x60, 0x80, 0x80, 0x60, 0x1e, 0x00, 0x00, 0x78, 0x06,     // "X"
+    0x01, 0x01, 0x06, 0x78, 0x00,
+    0x06, 0x00, 0x7e, 0x80, 0x00, 0x00, 0x80, 0x7e, 0x81, 0x00, 0x05, 0x01,     // "Y"
+    0x7e, 0x7e, 0x01, 0x00, 0x00,
+    0x0f, 0x00, 0x06, 0x06, 0x86, 0x86, 0x66, 0x1e, 0x00, 0x00, 0x78, 0x66,     // "Z"
+    0x61, 0x61, 0x60, 0x60, 0x00,
+    0x02, 0x00, 0x00, 0xfe, 0x81, 0x06, 0x82, 0x00, 0x00, 0x7f, 0x81, 0x60,     // "["
+    0x01, 0x00, 0x00,
+    0x03, 0x00, 0x0e, 0x0e, 0xf0, 0x86, 0x00, 0x03, 0x0f, 0x70, 0x70, 0x00,     // "\"
+    0x01, 0x00, 0x00, 0x81, 0x06, 0x00, 0xfe, 0x82, 0x00, 0x81, 0x60, 0x02,     // "]"
+    0x7f, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x18, 0x06, 0x06, 0x18, 0x88, 0x00,                       // "^"
+    0x87, 0x00, 0x84, 0x60, 0x00, 0x00,                                         // "_"
+    0x81, 0x00, 0x01, 0x06, 0x18, 0x89, 0x00,                                   // "`"
+    0x01, 0x00, 0x00, 0x82, 0x60, 0x03, 0x80, 0x00, 0x00, 0x18, 0x82, 0x66,     // "a"
+    0x01, 0x7f, 0x00,
+    0x02, 0x00, 0xfe, 0x80, 0x81, 0x60, 0x04, 0x80, 0x00, 0x00, 0x7f, 0x61,     // "b"
+    0x81, 0x60, 0x01, 0x1f, 0x00,
+    0x01, 0x00, 0x80, 0x82, 0x60, 0x03, 0x80, 0x00, 0x00, 0x1f, 0x82, 0x60,     // "c"
+    0x01, 0x19, 0x00,
+    0x01, 0x00, 0x80, 0x81, 0x60, 0x04, 0x80, 0xfe, 0x00, 0x00, 0x1f, 0x81,     // "d"
+    0x60, 0x02, 0x61, 0x7f, 0x00,
+    0x01, 0x00, 0x80, 0x82, 0x60, 0x03, 0x80, 0x00, 0x00, 0x1f, 0x82, 0x66,     // "e"
+    0x01, 0x67, 0x00,
+    0x02, 0x00, 0x80, 0xf8, 0x81, 0x86, 0x04, 0x18, 0x00, 0x00, 0x01, 0x7f,     // "f"
+    0x81, 0x01, 0x01, 0x00, 0x00,
+    0x01, 0x00, 0x80, 0x81, 0x60, 0x04, 0x80, 0xe0, 0x00, 0x00, 0x03, 0x81,     // "g"
+    0x6c, 0x02, 0x6d, 0x7f, 0x00,
+    0x02, 0x00, 0xfe, 0x00, 0x81, 0x80, 0x81, 0x00, 0x01, 0x7f, 0x06, 0x81,     // "h"
+    0x01, 0x01, 0x7e, 0x00,
+    0x04, 0x00, 0x00, 0x60, 0xe6, 0xe6, 0x83, 0x00, 0x05, 0x60, 0x7f, 0x7f,     // "i"
+    0x60, 0x00, 0x00,
+    0x83, 0x00, 0x0a, 0xe6, 0xe6, 0x00, 0x00, 0x18, 0x18, 0x60, 0x60, 0x1f,     // "j"
+    0x1f, 0x00,
+    0x0f, 0x00, 0xfe, 0x00, 0x00, 0x80, 0x60, 0x60, 0x00, 0x00, 0x7f, 0x06,     // "k"
+    0x06, 0x19, 0x60, 0x60, 0x00,
+    0x04, 0x00, 0x00, 0x06, 0xfe, 0xfe, 0x83, 0x00, 0x05, 0x60, 0x7f, 0x7f,     // "l"
+    0x60, 0x00, 0x00,
+    0x0f, 0x00, 0xe0, 0x60, 0x80, 0x80, 0x60, 0x80, 0x00, 0x00, 0x7f, 0x00,     // "m"
+    0x03, 0x03, 0x00, 0x7f, 0x00,
+    0x02, 0x00, 0xe0, 0x80, 0x81, 0x60, 0x04, 0x80, 0x00, 0x00, 0x7f, 0x01,     // "n"
+    0x81, 0x00, 0x01, 0x7f, 0x00,
+    0x01, 0x00, 0x80, 0x82, 0x60, 0x03, 0x80, 0x00, 0x00, 0x1f, 0x82, 0x60,     // "o"
+    0x01, 0x1f, 0x00,
+    0x02, 0x00, 0xe0, 0x80, 0x81, 0x60, 0x04, 0x80, 0x00, 0x00, 0x7f, 0x0d,     // "p"
+    0x81, 0x0c, 0x01, 0x03, 0x00,
+    0x01, 0x00, 0x80, 0x81, 0x60, 0x04, 0x80, 0xe0, 0x00, 0x00, 0x03, 0x81,     // "q"
+    0x0c, 0x02, 0x0d, 0x7f, 0x00,
+    0x02, 0x00, 0xe0, 0x80, 0x81, 0x60, 0x04, 0x80, 0x00, 0x00, 0x7f, 0x01,     // "r"
+    0x81, 0x00, 0x01, 0x01, 0x00,
+    0x01, 0x00, 0x80, 0x83, 0x60, 0x02, 0x00, 0x00, 0x61, 0x82, 0x66, 0x01,     // "s"
+    0x18, 0x00,
+    0x04, 0x00, 0x60, 0xf8, 0x60, 0x60, 0x83, 0x00, 0x00, 0x1f, 0x81, 0x60,     // "t"
+    0x01, 0x18, 0x00,
+    0x01, 0x00, 0xe0, 0x82, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0x81, 0x60,     // "u"
+    0x02, 0x18, 0x7f, 0x00,
+    0x01, 0x00, 0xe0, 0x82, 0x00, 0x09, 0xe0, 0x00, 0x00, 0x07, 0x18, 0x60,     // "v"
+    0x60, 0x18, 0x07, 0x00,
+    0x01, 0x00, 0xe0, 0x82, 0x00, 0x09, 0xe0, 0x00, 0x00, 0x1f, 0x60, 0x1c,     // "w"
+    0x1c, 0x60, 0x1f, 0x00,
+    0x0f, 0x00, 0x60, 0x80, 0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x60, 0x19,     // "x"
+    0x06, 0x06, 0x19, 0x60, 0x00,
+    0x01, 0x00, 0xe0, 0x82, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x01, 0x82, 0x66,     // "y"
+    0x01, 0x1f, 0x00,
+    0x00, 0x00, 0x82, 0x60, 0x0a, 0xe0, 0x60, 0x00, 0x00, 0x60, 0x78, 0x66,     // "z"
+    0x66, 0x61, 0x60, 0x00,
+    0x05, 0x00, 0x00, 0x80, 0x78, 0x78, 0x06, 0x82, 0x00, 0x05, 0x01, 0x1e,     // "{"
+    0x1e, 0x60, 0x00, 0x00,
+    0x81, 0x00, 0x01, 0xfe, 0xfe, 0x84, 0x00, 0x01, 0x7f, 0x7f, 0x81, 0x00,     // "|"
+    0x05, 0x00, 0x00, 0x06, 0x78, 0x78, 0x80, 0x82, 0x00, 0x05, 0x60, 0x1e,     // "}"
+    0x1e, 0x01, 0x00, 0x00,
+    0x0f, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00,     // "~"
+    0x00, 0x03, 0x03, 0x00, 0x00
+};
+
+const font_t font8x16RLE = {.encoding = FONT_RLE, .height = 16, .first = ' ', .last = '~', .widths = font8x16RLEWidths, .offsets = font8x16RLEOffsets, .bitmaps = font8x16RLEBitmaps};
+
+//======================================
+// 12x16 font, every character 12 pixels wide, compressed
+//======================================
+static const uint8 font12x16RLEWidths[95] = {
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12
+};
+
+static const uint16 font12x16RLEOffsets[95] = {
+    0, 2, 14, 25, 50, 74, 99, 123, 130, 150, 170, 181,
+    203, 212, 224, 231, 247, 272, 290, 314, 337, 360, 379, 398,
+    418, 437, 456, 468, 482, 502, 514, 534, 554, 579, 598, 617,
+    636, 655, 674, 691, 714, 733, 755, 776, 801, 814, 836, 861,
+    880, 897, 919, 938, 957, 973, 992, 1014, 1036, 1061, 1084, 1107,
+    1123, 1139, 1155, 1166, 1172, 1181, 1198, 1221, 1240, 1263, 1282, 1303,
+    1324, 1345, 1363, 1380, 1405, 1423, 1448, 1471, 1490, 1511, 1532, 1555,
+    1572, 1591, 1612, 1634, 1656, 1681, 1700, 1722, 1742, 1754, 1774
+};
+
+static const uint8 font12x16RLEBitmaps[1793] = {
+    0x96, 0x00,                                                                 // " " (space)
+    0x83, 0x00, 0x01, 0xfe, 0xfe, 0x88, 0x00, 0x01, 0x67, 0x67, 0x83, 0x00,     // "!"
+    0x81, 0x00, 0x05, 0x7e, 0x7e, 0x00, 0x00, 0x7e, 0x7e, 0x8d, 0x00,           // """
+    0x17, 0x00, 0x60, 0x60, 0xfe, 0xfe, 0x60, 0x60, 0xfe, 0xfe, 0x60, 0x60,     // "#"
+    0x00, 0x00, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06, 0x7f, 0x7f, 0x06, 0x06,
+    0x00,
+    0x09, 0x00, 0x60, 0x60, 0x98, 0x98, 0xfe, 0xfe, 0x98, 0x98, 0x18, 0x82,     // "$"
+    0x00, 0x09, 0x18, 0x19, 0x19, 0x7f, 0x7f, 0x19, 0x19, 0x06, 0x06, 0x00,
+    0x01, 0x00, 0x00, 0x81, 0x1c, 0x0d, 0x80, 0x80, 0x70, 0x70, 0x0c, 0x0c,     // "%"
+    0x00, 0x00, 0x30, 0x30, 0x0e, 0x0e, 0x01, 0x01, 0x81, 0x38, 0x01, 0x00,
+    0x00,
+    0x08, 0x00, 0x78, 0x78, 0x86, 0x86, 0x66, 0x66, 0x18, 0x18, 0x82, 0x00,     // "&"
+    0x0a, 0x1e, 0x1e, 0x61, 0x61, 0x66, 0x66, 0x18, 0x18, 0x66, 0x66, 0x00,
+    0x83, 0x00, 0x01, 0x7e, 0x7e, 0x8f, 0x00,                                   // "'"
+    0x81, 0x00, 0x05, 0xe0, 0xe0, 0x18, 0x18, 0x06, 0x06, 0x84, 0x00, 0x05,     // "("
+    0x07, 0x07, 0x18, 0x18, 0x60, 0x60, 0x81, 0x00,
+    0x81, 0x00, 0x05, 0x06, 0x06, 0x18, 0x18, 0xe0, 0xe0, 0x84, 0x00, 0x05,     // ")"
+    0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x81, 0x00,
+    0x81, 0x00, 0x05, 0x66, 0x66, 0x18, 0x18, 0x66, 0x66, 0x8d, 0x00,           // "*"
+    0x01, 0x00, 0x00, 0x81, 0x80, 0x01, 0xf0, 0xf0, 0x81, 0x80, 0x82, 0x00,     // "+"
+    0x81, 0x01, 0x01, 0x0f, 0x0f, 0x81, 0x01, 0x01, 0x00, 0x00,
+    0x8e, 0x00, 0x03, 0x60, 0x60, 0x1c, 0x1c, 0x82, 0x00,                       // ","
+    0x01, 0x00, 0x00, 0x86, 0x80, 0x82, 0x00, 0x86, 0x01, 0x01, 0x00, 0x00,     // "-"
+    0x8f, 0x00, 0x01, 0x30, 0x30, 0x83, 0x00,                                   // "."
+    0x84, 0x00, 0x03, 0xf0, 0xf0, 0x0e, 0x0e, 0x82, 0x00, 0x03, 0x70, 0x70,     // "/"
+    0x0f, 0x0f, 0x84, 0x00,
+    0x17, 0x00, 0xf8, 0xf8, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0xf8, 0xf8,     // "0"
+    0x00, 0x00, 0x1f, 0x1f, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x1f, 0x1f,
+    0x00,
+    0x81, 0x00, 0x03, 0x18, 0x18, 0xfe, 0xfe, 0x86, 0x00, 0x05, 0x60, 0x60,     // "1"
+    0x7f, 0x7f, 0x60, 0x60, 0x81, 0x00,
+    0x02, 0x00, 0x18, 0x18, 0x82, 0x06, 0x10, 0x86, 0x86, 0x78, 0x78, 0x00,     // "2"
+    0x00, 0x60, 0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x00,
+    0x00, 0x00, 0x82, 0x06, 0x09, 0x66, 0x66, 0x9e, 0x9e, 0x06, 0x06, 0x00,     // "3"
+    0x00, 0x18, 0x18, 0x82, 0x60, 0x04, 0x61, 0x61, 0x1e, 0x1e, 0x00,
+    0x08, 0x00, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0xfe, 0xfe, 0x82, 0x00,     // "4"
+    0x01, 0x07, 0x07, 0x82, 0x06, 0x04, 0x7f, 0x7f, 0x06, 0x06, 0x00,
+    0x02, 0x00, 0x7e, 0x7e, 0x84, 0x66, 0x05, 0x86, 0x86, 0x00, 0x00, 0x18,     // "5"
+    0x18, 0x84, 0x60, 0x02, 0x1f, 0x1f, 0x00,
+    0x04, 0x00, 0xe0, 0xe0, 0x98, 0x98, 0x82, 0x86, 0x82, 0x00, 0x01, 0x1f,     // "6"
+    0x1f, 0x84, 0x61, 0x02, 0x1e, 0x1e, 0x00,
+    0x00, 0x00, 0x82, 0x06, 0x05, 0x86, 0x86, 0x66, 0x66, 0x1e, 0x1e, 0x82,     // "7"
+    0x00, 0x03, 0x7e, 0x7e, 0x01, 0x01, 0x83, 0x00,
+    0x02, 0x00, 0x78, 0x78, 0x84, 0x86, 0x05, 0x78, 0x78, 0x00, 0x00, 0x1e,     // "8"
+    0x1e, 0x84, 0x61, 0x02, 0x1e, 0x1e, 0x00,
+    0x02, 0x00, 0x78, 0x78, 0x84, 0x86, 0x01, 0xf8, 0xf8, 0x82, 0x00, 0x82,     // "9"
+    0x61, 0x04, 0x19, 0x19, 0x07, 0x07, 0x00,
+    0x83, 0x00, 0x01, 0x60, 0x60, 0x88, 0x00, 0x01, 0x06, 0x06, 0x83, 0x00,     // ":"
+    0x83, 0x00, 0x01, 0x60, 0x60, 0x86, 0x00, 0x03, 0x30, 0x30, 0x0e, 0x0e,     // ";"
+    0x83, 0x00,
+    0x81, 0x00, 0x05, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0x84, 0x00, 0x05,     // "<"
+    0x01, 0x01, 0x06, 0x06, 0x18, 0x18, 0x81, 0x00,
+    0x01, 0x00, 0x00, 0x86, 0x60, 0x82, 0x00, 0x86, 0x06, 0x01, 0x00, 0x00,     // "="
+    0x81, 0x00, 0x05, 0x18, 0x18, 0x60, 0x60, 0x80, 0x80, 0x84, 0x00, 0x05,     // ">"
+    0x18, 0x18, 0x06, 0x06, 0x01, 0x01, 0x81, 0x00,
+    0x02, 0x00, 0x18, 0x18, 0x82, 0x06, 0x03, 0x86, 0x86, 0x78, 0x78, 0x84,     // "?"
+    0x00, 0x03, 0x66, 0x66, 0x01, 0x01, 0x81, 0x00,
+    0x17, 0x00, 0xf8, 0xf8, 0x06, 0xe6, 0xe6, 0x66, 0x46, 0x66, 0xf8, 0xf8,     // "@"
+    0x00, 0x00, 0x1f, 0x7f, 0x60, 0x67, 0x67, 0x66, 0x66, 0x6c, 0x0f, 0x0f,
+    0x00,
+    0x02, 0x00, 0xf8, 0xf8, 0x84, 0x86, 0x05, 0xf8, 0xf8, 0x00, 0x00, 0x7f,     // "A"
+    0x7f, 0x84, 0x01, 0x02, 0x7f, 0x7f, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x86, 0x05, 0x78, 0x78, 0x00, 0x00, 0x7f,     // "B"
+    0x7f, 0x84, 0x61, 0x02, 0x1e, 0x1e, 0x00,
+    0x02, 0x00, 0xf8, 0xf8, 0x84, 0x06, 0x05, 0x18, 0x18, 0x00, 0x00, 0x1f,     // "C"
+    0x1f, 0x84, 0x60, 0x02, 0x18, 0x18, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x06, 0x05, 0xf8, 0xf8, 0x00, 0x00, 0x7f,     // "D"
+    0x7f, 0x84, 0x60, 0x02, 0x1f, 0x1f, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x86, 0x05, 0x06, 0x06, 0x00, 0x00, 0x7f,     // "E"
+    0x7f, 0x84, 0x61, 0x02, 0x60, 0x60, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x86, 0x05, 0x06, 0x06, 0x00, 0x00, 0x7f,     // "F"
+    0x7f, 0x84, 0x01, 0x81, 0x00,
+    0x04, 0x00, 0xf8, 0xf8, 0x06, 0x06, 0x82, 0x86, 0x07, 0x98, 0x98, 0x00,     // "G"
+    0x00, 0x1f, 0x1f, 0x60, 0x60, 0x82, 0x61, 0x02, 0x1f, 0x1f, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x80, 0x05, 0xfe, 0xfe, 0x00, 0x00, 0x7f,     // "H"
+    0x7f, 0x84, 0x01, 0x02, 0x7f, 0x7f, 0x00,
+    0x01, 0x00, 0x00, 0x81, 0x06, 0x01, 0xfe, 0xfe, 0x81, 0x06, 0x82, 0x00,     // "I"
+    0x81, 0x60, 0x01, 0x7f, 0x7f, 0x81, 0x60, 0x01, 0x00, 0x00,
+    0x81, 0x00, 0x81, 0x06, 0x01, 0xfe, 0xfe, 0x81, 0x06, 0x03, 0x00, 0x00,     // "J"
+    0x18, 0x18, 0x81, 0x60, 0x01, 0x1f, 0x1f, 0x82, 0x00,
+    0x17, 0x00, 0xfe, 0xfe, 0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0x06, 0x06,     // "K"
+    0x00, 0x00, 0x7f, 0x7f, 0x01, 0x01, 0x06, 0x06, 0x18, 0x18, 0x60, 0x60,
+    0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x88, 0x00, 0x01, 0x7f, 0x7f, 0x86, 0x60, 0x00,     // "L"
+    0x00,
+    0x0e, 0x00, 0xfe, 0xfe, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0xfe, 0xfe,     // "M"
+    0x00, 0x00, 0x7f, 0x7f, 0x84, 0x00, 0x02, 0x7f, 0x7f, 0x00,
+    0x17, 0x00, 0xfe, 0xfe, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0xfe, 0xfe,     // "N"
+    0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x01, 0x01, 0x06, 0x06, 0x7f, 0x7f,
+    0x00,
+    0x02, 0x00, 0xf8, 0xf8, 0x84, 0x06, 0x05, 0xf8, 0xf8, 0x00, 0x00, 0x1f,     // "O"
+    0x1f, 0x84, 0x60, 0x02, 0x1f, 0x1f, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x86, 0x05, 0x78, 0x78, 0x00, 0x00, 0x7f,     // "P"
+    0x7f, 0x84, 0x01, 0x81, 0x00,
+    0x02, 0x00, 0xf8, 0xf8, 0x84, 0x06, 0x0e, 0xf8, 0xf8, 0x00, 0x00, 0x1f,     // "Q"
+    0x1f, 0x60, 0x60, 0x66, 0x66, 0x18, 0x18, 0x67, 0x67, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x86, 0x05, 0x78, 0x78, 0x00, 0x00, 0x7f,     // "R"
+    0x7f, 0x84, 0x01, 0x02, 0x7e, 0x7e, 0x00,
+    0x02, 0x00, 0x78, 0x78, 0x84, 0x86, 0x05, 0x06, 0x06, 0x00, 0x00, 0x60,     // "S"
+    0x60, 0x84, 0x61, 0x02, 0x1e, 0x1e, 0x00,
+    0x00, 0x00, 0x82, 0x06, 0x01, 0xfe, 0xfe, 0x82, 0x06, 0x84, 0x00, 0x01,     // "T"
+    0x7f, 0x7f, 0x83, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x00, 0x05, 0xfe, 0xfe, 0x00, 0x00, 0x1f,     // "U"
+    0x1f, 0x84, 0x60, 0x02, 0x1f, 0x1f, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x00, 0x0e, 0xfe, 0xfe, 0x00, 0x00, 0x07,     // "V"
+    0x07, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x84, 0x00, 0x0e, 0xfe, 0xfe, 0x00, 0x00, 0x1f,     // "W"
+    0x1f, 0x60, 0x60, 0x1c, 0x1c, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x17, 0x00, 0x1e, 0x1e, 0x60, 0x60, 0x80, 0x80, 0x60, 0x60, 0x1e, 0x1e,     // "X"
+    0x00, 0x00, 0x78, 0x78, 0x06, 0x06, 0x01, 0x01, 0x06, 0x06, 0x78, 0x78,
+    0x00,
+    0x0a, 0x00, 0x7e, 0x7e, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x7e, 0x7e,     // "Y"
+    0x82, 0x00, 0x05, 0x01, 0x01, 0x7e, 0x7e, 0x01, 0x01, 0x81, 0x00,
+    0x00, 0x00, 0x82, 0x06, 0x0d, 0x86, 0x86, 0x66, 0x66, 0x1e, 0x1e, 0x00,     // "Z"
+    0x00, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x82, 0x60, 0x00, 0x00,
+    0x81, 0x00, 0x01, 0xfe, 0xfe, 0x82, 0x06, 0x84, 0x00, 0x01, 0x7f, 0x7f,     // "["
+    0x82, 0x60, 0x81, 0x00,
+    0x05, 0x00, 0x00, 0x0e, 0x0e, 0xf0, 0xf0, 0x8a, 0x00, 0x05, 0x0f, 0x0f,     // "\"
+    0x70, 0x70, 0x00, 0x00,
+    0x81, 0x00, 0x82, 0x06, 0x01, 0xfe, 0xfe, 0x84, 0x00, 0x82, 0x60, 0x01,     // "]"
+    0x7f, 0x7f, 0x81, 0x00,
+    0x81, 0x00, 0x05, 0x18, 0x18, 0x06, 0x06, 0x18, 0x18, 0x8d, 0x00,           // "^"
+    0x8b, 0x00, 0x88, 0x60, 0x00, 0x00,                                         // "_"
+    0x82, 0x00, 0x03, 0x06, 0x06, 0x18, 0x18, 0x8e, 0x00,                       // "`"
+    0x81, 0x00, 0x84, 0x60, 0x05, 0x80, 0x80, 0x00, 0x00, 0x18, 0x18, 0x84,     // "a"
+    0x66, 0x02, 0x7f, 0x7f, 0x00,
+    0x04, 0x00, 0xfe, 0xfe, 0x80, 0x80, 0x82, 0x60, 0x07, 0x80, 0x80, 0x00,     // "b"
+    0x00, 0x7f, 0x7f, 0x61, 0x61, 0x82, 0x60, 0x02, 0x1f, 0x1f, 0x00,
+    0x02, 0x00, 0x80, 0x80, 0x84, 0x60, 0x05, 0x80, 0x80, 0x00, 0x00, 0x1f,     // "c"
+    0x1f, 0x84, 0x60, 0x02, 0x19, 0x19, 0x00,
+    0x02, 0x00, 0x80, 0x80, 0x82, 0x60, 0x07, 0x80, 0x80, 0xfe, 0xfe, 0x00,     // "d"
+    0x00, 0x1f, 0x1f, 0x82, 0x60, 0x04, 0x61, 0x61, 0x7f, 0x7f, 0x00,
+    0x02, 0x00, 0x80, 0x80, 0x84, 0x60, 0x05, 0x80, 0x80, 0x00, 0x00, 0x1f,     // "e"
+    0x1f, 0x84, 0x66, 0x02, 0x67, 0x67, 0x00,
+    0x04, 0x00, 0x80, 0x80, 0xf8, 0xf8, 0x82, 0x86, 0x07, 0x18, 0x18, 0x00,     // "f"
+    0x00, 0x01, 0x01, 0x7f, 0x7f, 0x82, 0x01, 0x81, 0x00,
+    0x02, 0x00, 0x80, 0x80, 0x83, 0x60, 0x06, 0x80, 0xe0, 0xe0, 0x00, 0x00,     // "g"
+    0x03, 0x03, 0x83, 0x6c, 0x03, 0x6d, 0x7f, 0x7f, 0x00,
+    0x04, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x82, 0x80, 0x82, 0x00, 0x03, 0x7f,     // "h"
+    0x7f, 0x06, 0x06, 0x82, 0x01, 0x02, 0x7e, 0x7e, 0x00,
+    0x81, 0x00, 0x03, 0x60, 0x60, 0xe6, 0xe6, 0x86, 0x00, 0x05, 0x60, 0x60,     // "i"
+    0x7f, 0x7f, 0x60, 0x60, 0x81, 0x00,
+    0x86, 0x00, 0x01, 0xe6, 0xe6, 0x82, 0x00, 0x01, 0x18, 0x18, 0x82, 0x60,     // "j"
+    0x03, 0x1f, 0x1f, 0x00, 0x00,
+    0x02, 0x00, 0xfe, 0xfe, 0x81, 0x00, 0x03, 0x80, 0x80, 0x60, 0x60, 0x81,     // "k"
+    0x00, 0x01, 0x7f, 0x7f, 0x81, 0x06, 0x05, 0x19, 0x19, 0x60, 0x60, 0x00,
+    0x00,
+    0x81, 0x00, 0x03, 0x06, 0x06, 0xfe, 0xfe, 0x86, 0x00, 0x05, 0x60, 0x60,     // "l"
+    0x7f, 0x7f, 0x60, 0x60, 0x81, 0x00,
+    0x17, 0x00, 0xe0, 0xe0, 0x60, 0x60, 0x80, 0x80, 0x60, 0x60, 0x80, 0x80,     // "m"
+    0x00, 0x00, 0x7f, 0x7f, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x7f, 0x7f,
+    0x00,
+    0x04, 0x00, 0xe0, 0xe0, 0x80, 0x80, 0x82, 0x60, 0x07, 0x80, 0x80, 0x00,     // "n"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x82, 0x00, 0x02, 0x7f, 0x7f, 0x00,
+    0x02, 0x00, 0x80, 0x80, 0x84, 0x60, 0x05, 0x80, 0x80, 0x00, 0x00, 0x1f,     // "o"
+    0x1f, 0x84, 0x60, 0x02, 0x1f, 0x1f, 0x00,
+    0x03, 0x00, 0xe0, 0xe0, 0x80, 0x83, 0x60, 0x06, 0x80, 0x80, 0x00, 0x00,     // "p"
+    0x7f, 0x7f, 0x0d, 0x83, 0x0c, 0x02, 0x03, 0x03, 0x00,
+    0x02, 0x00, 0x80, 0x80, 0x83, 0x60, 0x06, 0x80, 0xe0, 0xe0, 0x00, 0x00,     // "q"
+    0x03, 0x03, 0x83, 0x0c, 0x03, 0x0d, 0x7f, 0x7f, 0x00,
+    0x04, 0x00, 0xe0, 0xe0, 0x80, 0x80, 0x82, 0x60, 0x07, 0x80, 0x80, 0x00,     // "r"
+    0x00, 0x7f, 0x7f, 0x01, 0x01, 0x82, 0x00, 0x02, 0x01, 0x01, 0x00,
+    0x02, 0x00, 0x80, 0x80, 0x85, 0x60, 0x81, 0x00, 0x01, 0x01, 0x61, 0x84,     // "s"
+    0x66, 0x02, 0x18, 0x18, 0x00,
+    0x06, 0x00, 0x60, 0x60, 0xf8, 0xf8, 0x60, 0x60, 0x86, 0x00, 0x01, 0x1f,     // "t"
+    0x1f, 0x82, 0x60, 0x02, 0x18, 0x18, 0x00,
+    0x02, 0x00, 0xe0, 0xe0, 0x84, 0x00, 0x05, 0xe0, 0xe0, 0x00, 0x00, 0x1f,     // "u"
+    0x1f, 0x82, 0x60, 0x04, 0x18, 0x18, 0x7f, 0x7f, 0x00,
+    0x02, 0x00, 0xe0, 0xe0, 0x84, 0x00, 0x0e, 0xe0, 0xe0, 0x00, 0x00, 0x07,     // "v"
+    0x07, 0x18, 0x18, 0x60, 0x60, 0x18, 0x18, 0x07, 0x07, 0x00,
+    0x02, 0x00, 0xe0, 0xe0, 0x84, 0x00, 0x0e, 0xe0, 0xe0, 0x00, 0x00, 0x1f,     // "w"
+    0x1f, 0x60, 0x60, 0x1c, 0x1c, 0x60, 0x60, 0x1f, 0x1f, 0x00,
+    0x17, 0x00, 0x60, 0x60, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x60, 0x60,     // "x"
+    0x00, 0x00, 0x60, 0x60, 0x19, 0x19, 0x06, 0x06, 0x19, 0x19, 0x60, 0x60,
+    0x00,
+    0x02, 0x00, 0xe0, 0xe0, 0x84, 0x00, 0x05, 0xe0, 0xe0, 0x00, 0x00, 0x01,     // "y"
+    0x01, 0x84, 0x66, 0x02, 0x1f, 0x1f, 0x00,
+    0x00, 0x00, 0x84, 0x60, 0x10, 0xe0, 0xe0, 0x60, 0x60, 0x00, 0x00, 0x60,     // "z"
+    0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x00,
+    0x81, 0x00, 0x05, 0x80, 0x80, 0x78, 0x78, 0x06, 0x06, 0x84, 0x00, 0x05,     // "{"
+    0x01, 0x01, 0x1e, 0x1e, 0x60, 0x60, 0x81, 0x00,
+    0x83, 0x00, 0x01, 0xfe, 0xfe, 0x88, 0x00, 0x01, 0x7f, 0x7f, 0x83, 0x00,     // "|"
+    0x81, 0x00, 0x05, 0x06, 0x06, 0x78, 0x78, 0x80, 0x80, 0x84, 0x00, 0x05,     // "}"
+    0x60, 0x60, 0x1e, 0x1e, 0x01, 0x01, 0x81, 0x00,
+    0x81, 0x00, 0x81, 0xc0, 0x81, 0x00, 0x05, 0xc0, 0xc0, 0x00, 0x00, 0x03,     // "~"
+    0x03, 0x81, 0x00, 0x81, 0x03, 0x81, 0x00
+};
+
+const font_t font12x16RLE = {.encoding = FONT_RLE, .height = 16, .first = ' ', .last = '~', .widths = font12x16RLEWidths, .offsets = font12x16RLEOffsets, .bitmaps = font12x16RLEBitmaps};
+
+//======================================
+// 16x24 font, every character 16 pixels wide
+//======================================
+static const uint8 font16x24Widths[95] = {
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16
+};
+
+static const uint16 font16x24Offsets[95] = {
+    0, 48, 96, 144, 192, 240, 288, 336, 384, 432, 480, 528,
+    576, 624, 672, 720, 768, 816, 864, 912, 960, 1008, 1056, 1104,
+    1152, 1200, 1248, 1296, 1344, 1392, 1440, 1488, 1536, 1584, 1632, 1680,
+    1728, 1776, 1824, 1872, 1920, 1968, 2016, 2064, 2112, 2160, 2208, 2256,
+    2304, 2352, 2400, 2448, 2496, 2544, 2592, 2640, 2688, 2736, 2784, 2832,
+    2880, 2928, 2976, 3024, 3072, 3120, 3168, 3216, 3264, 3312, 3360, 3408,
+    3456, 3504, 3552, 3600, 3648, 3696, 3744, 3792, 3840, 3888, 3936, 3984,
+    4032, 4080, 4128, 4176, 4224, 4272, 4320, 4368, 4416, 4464, 4512
+};
+
+static const uint8 font16x24Bitmaps[4560] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // " " (space)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00,     // "!"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xfe, 0xfe, 0xfe,     // """
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0xfe, 0xfe, 0xfe, 0x80, 0x80, 0xfe, 0xfe, 0xfe,     // "#"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0xff, 0xff, 0xff, 0xe3,
+    0xe3, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x70, 0x70, 0x70, 0xfe, 0xfe, 0x70, 0x70, 0x70,     // "$"
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1c, 0x1c, 0x1c, 0xff,
+    0xff, 0x1c, 0x1c, 0x1c, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x07, 0x07, 0x07, 0x3f, 0x3f, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x78, 0x00, 0x00, 0xc0, 0xc0, 0xc0,     // "%"
+    0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x1c,
+    0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c,
+    0x03, 0x03, 0x03, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e, 0x70, 0x70, 0x70,     // "&"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0x1c, 0x1c, 0x1c, 0xe3,
+    0xe3, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00,     // "'"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x70, 0x70, 0x0e, 0x0e, 0x0e,     // "("
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x70, 0x70, 0x80, 0x80, 0x80,     // ")"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x8e, 0x8e, 0x8e, 0x70, 0x70, 0x8e, 0x8e, 0x8e,     // "*"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00,     // "+"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0xff,
+    0xff, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // ","
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "-"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "."
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x3e,     // "/"
+    0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0,
+    0x0f, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+    0x3c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e, 0x8e,     // "0"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0x1c,
+    0x1c, 0x03, 0x03, 0x03, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0xfe, 0xfe, 0x00, 0x00, 0x00,     // "1"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x70, 0x70, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "2"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    0xe0, 0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x3f, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e, 0x7e, 0x7e, 0x7e,     // "3"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x03, 0x1c, 0x1c, 0x1c, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x70, 0x70, 0xfe, 0xfe, 0xfe,     // "4"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xe3, 0xe3, 0xe3, 0xe0,
+    0xe0, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,     // "5"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x70, 0x70, 0x70, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "6"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e, 0x8e,     // "7"
+    0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x1c,
+    0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "8"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "9"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,     // ":"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3,
+    0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00,     // ";"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3,
+    0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x70, 0x70, 0x70,     // "<"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0xe3,
+    0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "="
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x80, 0x80, 0x00, 0x00, 0x00,     // ">"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3,
+    0xe3, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x70, 0x70, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "?"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    0xe0, 0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x8e, 0x8e, 0x8e, 0x8e, 0x0e, 0x0e, 0x8e,     // "@"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+    0xe3, 0xe2, 0xe2, 0x83, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x3f,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x03, 0x03, 0x03, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "A"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "B"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "C"
+    0x70, 0x70, 0x70, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "D"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "E"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "F"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "G"
+    0x70, 0x70, 0x70, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "H"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e,     // "I"
+    0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0x38, 0x38, 0x38, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0xfe, 0x0e,     // "J"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x80, 0x80, 0x70, 0x70, 0x70,     // "K"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0xe3,
+    0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "L"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x70, 0x70, 0x70, 0x80, 0x80, 0x70, 0x70, 0x70,     // "M"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,     // "N"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x1c,
+    0x1c, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "O"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "P"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "Q"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xe0,
+    0xe0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "R"
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "S"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e,     // "T"
+    0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "U"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "V"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "W"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x07, 0x07, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x7e, 0x7e, 0x7e, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80,     // "X"
+    0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0x1c,
+    0x1c, 0xe3, 0xe3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "Y"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1c, 0x1c, 0x1c, 0xe0,
+    0xe0, 0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x8e, 0x8e, 0x8e,     // "Z"
+    0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x1c,
+    0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "["
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3e, 0x3e, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00,     // "\"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x0f,
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x3c, 0x3c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0xfe,     // "]"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x0e, 0x0e, 0x70, 0x70, 0x70,     // "^"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "_"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x70, 0x70, 0x70, 0x00,     // "`"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "a"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,     // "b"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "c"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,     // "d"
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "e"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e,     // "f"
+    0x70, 0x70, 0x70, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0xff, 0xff, 0xff, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,     // "g"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "h"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x8e, 0x8e, 0x00, 0x00, 0x00,     // "i"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e,     // "j"
+    0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x07, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,     // "k"
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xe0, 0xe0, 0xe0, 0xe0,
+    0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x07, 0x38, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0xfe, 0xfe, 0x00, 0x00, 0x00,     // "l"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x80,     // "m"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x03, 0x03, 0x7c,
+    0x7c, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,     // "n"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "o"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "p"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x9c, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x7c, 0x7c, 0x7c, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00,     // "q"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x7c, 0x7c, 0x7c, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x9c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,     // "r"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x1c, 0x1c, 0x1c, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x3f, 0x3f, 0x3f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "s"
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0xe3, 0xe3, 0xe3, 0xe3,
+    0xe3, 0xe3, 0xe3, 0xe3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0xf0, 0xf0, 0xf0, 0x80, 0x80, 0x00, 0x00, 0x00,     // "t"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0xff, 0xff, 0xff, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "u"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x3f, 0x3f, 0x3f, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "v"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x07, 0x07, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "w"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0x07, 0x07,
+    0x38, 0x38, 0x38, 0x07, 0x07, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "x"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x03, 0x03, 0x1c, 0x1c, 0x1c, 0xe0,
+    0xe0, 0x1c, 0x1c, 0x1c, 0x03, 0x03, 0x03, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x07, 0x07, 0x07, 0x00, 0x00, 0x07, 0x07, 0x07, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "y"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x1f, 0x1f, 0x1f, 0xe0, 0xe0, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x07, 0x07, 0x07, 0x00,
+    0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,     // "z"
+    0x80, 0x80, 0x80, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xe3,
+    0xe3, 0x1f, 0x1f, 0x1f, 0x03, 0x03, 0x03, 0x00, 0x00, 0x38, 0x38, 0x38,
+    0x3f, 0x3f, 0x3f, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x0e, 0x0e, 0x0e,     // "{"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0xe3,
+    0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x07, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0x00, 0x00,     // "|"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0xf0, 0xf0, 0x00, 0x00, 0x00,     // "}"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3,
+    0xe3, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x38, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     // "~"
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x0e, 0x0e, 0x0e, 0x0e,
+    0x70, 0x70, 0x70, 0x70, 0x0e, 0x0e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const font_t font16x24 = {.encoding = FONT_RAW, .height = 24, .first = ' ', .last = '~', .widths = font16x24Widths, .offsets = font16x24Offsets, .bitmaps = font16x24Bitmaps};
+
+//======================================
+// 16x24 font, every character 16 pixels wide, compressed
+//======================================
+static const uint8 font16x24RLEWidths[95] = {
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16
+};
+
+static const uint16 font16x24RLEOffsets[95] = {
+    0, 2, 19, 39, 77, 112, 145, 182, 194, 216, 238, 258,
+    279, 291, 297, 304, 326, 361, 384, 412, 443, 471, 497, 524,
+    547, 575, 600, 612, 631, 651, 661, 681, 705, 749, 777, 805,
+    828, 856, 877, 896, 926, 954, 979, 1001, 1036, 1052, 1090, 1125,
+    1153, 1177, 1212, 1240, 1264, 1285, 1313, 1341, 1379, 1411, 1440, 1465,
+    1483, 1505, 1523, 1534, 1540, 1548, 1569, 1598, 1621, 1651, 1672, 1695,
+    1722, 1747, 1772, 1794, 1827, 1850, 1883, 1912, 1935, 1962, 1989, 2014,
+    2034, 2062, 2092, 2120, 2158, 2196, 2221, 2248, 2271, 2288, 2311
+};
+
+static const uint8 font16x24RLEBitmaps[2323] = {
+    0xae, 0x00,                                                                 // " " (space)
+    0x85, 0x00, 0x01, 0xfe, 0xfe, 0x8c, 0x00, 0x01, 0xff, 0xff, 0x8c, 0x00,     // "!"
+    0x01, 0x38, 0x38, 0x85, 0x00,
+    0x82, 0x00, 0x81, 0xfe, 0x01, 0x00, 0x00, 0x81, 0xfe, 0x86, 0x00, 0x81,     // """
+    0x03, 0x01, 0x00, 0x00, 0x81, 0x03, 0x92, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x81, 0xfe, 0x01, 0x80, 0x80, 0x81, 0xfe, 0x81,     // "#"
+    0x80, 0x01, 0x00, 0x00, 0x81, 0xe3, 0x81, 0xff, 0x01, 0xe3, 0xe3, 0x81,
+    0xff, 0x81, 0xe3, 0x83, 0x00, 0x81, 0x3f, 0x01, 0x00, 0x00, 0x81, 0x3f,
+    0x82, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x81, 0x70, 0x01, 0xfe, 0xfe, 0x82, 0x70, 0x82,     // "$"
+    0x00, 0x81, 0x03, 0x81, 0x1c, 0x01, 0xff, 0xff, 0x81, 0x1c, 0x81, 0xe0,
+    0x82, 0x00, 0x82, 0x07, 0x01, 0x3f, 0x3f, 0x81, 0x07, 0x82, 0x00,
+    0x81, 0x00, 0x82, 0x78, 0x01, 0x00, 0x00, 0x81, 0xc0, 0x81, 0x38, 0x83,     // "%"
+    0x00, 0x81, 0xe0, 0x01, 0x1c, 0x1c, 0x81, 0x03, 0x83, 0x00, 0x81, 0x1c,
+    0x81, 0x03, 0x01, 0x00, 0x00, 0x82, 0x1f, 0x81, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x81, 0x0e, 0x01, 0x8e, 0x8e, 0x81, 0x70, 0x83,     // "&"
+    0x00, 0x81, 0xe3, 0x81, 0x1c, 0x01, 0xe3, 0xe3, 0x81, 0x00, 0x81, 0xe0,
+    0x01, 0x00, 0x00, 0x81, 0x07, 0x83, 0x38, 0x81, 0x07, 0x81, 0x38, 0x00,
+    0x00,
+    0x85, 0x00, 0x01, 0xfe, 0xfe, 0x8c, 0x00, 0x01, 0x03, 0x03, 0x95, 0x00,     // "'"
+    0x82, 0x00, 0x81, 0x80, 0x01, 0x70, 0x70, 0x81, 0x0e, 0x86, 0x00, 0x81,     // "("
+    0xff, 0x8e, 0x00, 0x01, 0x07, 0x07, 0x81, 0x38, 0x82, 0x00,
+    0x82, 0x00, 0x81, 0x0e, 0x01, 0x70, 0x70, 0x81, 0x80, 0x8b, 0x00, 0x81,     // ")"
+    0xff, 0x86, 0x00, 0x81, 0x38, 0x01, 0x07, 0x07, 0x85, 0x00,
+    0x82, 0x00, 0x81, 0x8e, 0x01, 0x70, 0x70, 0x81, 0x8e, 0x86, 0x00, 0x81,     // "*"
+    0x03, 0x01, 0x00, 0x00, 0x81, 0x03, 0x92, 0x00,
+    0x85, 0x00, 0x01, 0xc0, 0xc0, 0x88, 0x00, 0x82, 0x1c, 0x01, 0xff, 0xff,     // "+"
+    0x82, 0x1c, 0x88, 0x00, 0x01, 0x03, 0x03, 0x85, 0x00,
+    0x96, 0x00, 0x81, 0x80, 0x88, 0x00, 0x81, 0x38, 0x81, 0x07, 0x83, 0x00,     // ","
+    0x91, 0x00, 0x88, 0x1c, 0x91, 0x00,                                         // "-"
+    0xa5, 0x00, 0x01, 0x1c, 0x1c, 0x85, 0x00,                                   // "."
+    0x86, 0x00, 0x81, 0xc0, 0x01, 0x3e, 0x3e, 0x86, 0x00, 0x81, 0xf0, 0x81,     // "/"
+    0x0f, 0x86, 0x00, 0x01, 0x3c, 0x3c, 0x81, 0x03, 0x86, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x83, 0x0e, 0x81, 0x8e, 0x81, 0xf0, 0x01, 0x00,     // "0"
+    0x00, 0x81, 0xff, 0x81, 0xe0, 0x01, 0x1c, 0x1c, 0x81, 0x03, 0x81, 0xff,
+    0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x82, 0x00, 0x81, 0x70, 0x01, 0xfe, 0xfe, 0x8c, 0x00, 0x01, 0xff, 0xff,     // "1"
+    0x89, 0x00, 0x81, 0x38, 0x01, 0x3f, 0x3f, 0x81, 0x38, 0x82, 0x00,
+    0x00, 0x00, 0x81, 0x70, 0x86, 0x0e, 0x81, 0xf0, 0x86, 0x00, 0x01, 0xe0,     // "2"
+    0xe0, 0x81, 0x1c, 0x81, 0x03, 0x01, 0x00, 0x00, 0x81, 0x38, 0x81, 0x3f,
+    0x86, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x84, 0x0e, 0x01, 0x8e, 0x8e, 0x81, 0x7e, 0x81, 0x0e, 0x86,     // "3"
+    0x00, 0x01, 0x03, 0x03, 0x81, 0x1c, 0x81, 0xe0, 0x01, 0x00, 0x00, 0x81,
+    0x07, 0x86, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x82, 0x00, 0x81, 0x80, 0x01, 0x70, 0x70, 0x81, 0xfe, 0x83, 0x00, 0x81,     // "4"
+    0xfc, 0x81, 0xe3, 0x01, 0xe0, 0xe0, 0x81, 0xff, 0x81, 0xe0, 0x88, 0x00,
+    0x81, 0x3f, 0x82, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x8e, 0x81, 0x0e, 0x01, 0x00, 0x00, 0x89,     // "5"
+    0x03, 0x81, 0xfc, 0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38, 0x81, 0x07,
+    0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x81, 0x70, 0x83, 0x0e, 0x83, 0x00, 0x81, 0xff,     // "6"
+    0x86, 0x1c, 0x81, 0xe0, 0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38, 0x81,
+    0x07, 0x00, 0x00,
+    0x00, 0x00, 0x86, 0x0e, 0x81, 0x8e, 0x81, 0x7e, 0x83, 0x00, 0x81, 0xe0,     // "7"
+    0x01, 0x1c, 0x1c, 0x81, 0x03, 0x86, 0x00, 0x81, 0x3f, 0x87, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "8"
+    0xe3, 0x86, 0x1c, 0x81, 0xe3, 0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38,
+    0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "9"
+    0x03, 0x86, 0x1c, 0x81, 0xff, 0x83, 0x00, 0x83, 0x38, 0x81, 0x07, 0x82,
+    0x00,
+    0x85, 0x00, 0x01, 0x80, 0x80, 0x8c, 0x00, 0x01, 0xe3, 0xe3, 0x95, 0x00,     // ":"
+    0x85, 0x00, 0x01, 0x80, 0x80, 0x8c, 0x00, 0x01, 0xe3, 0xe3, 0x89, 0x00,     // ";"
+    0x81, 0x1c, 0x01, 0x03, 0x03, 0x85, 0x00,
+    0x85, 0x00, 0x01, 0x80, 0x80, 0x81, 0x70, 0x86, 0x00, 0x81, 0x1c, 0x01,     // "<"
+    0xe3, 0xe3, 0x8e, 0x00, 0x81, 0x07, 0x82, 0x00,
+    0x81, 0x00, 0x88, 0x80, 0x84, 0x00, 0x88, 0xe3, 0x91, 0x00,                 // "="
+    0x82, 0x00, 0x81, 0x70, 0x01, 0x80, 0x80, 0x8c, 0x00, 0x01, 0xe3, 0xe3,     // ">"
+    0x81, 0x1c, 0x86, 0x00, 0x81, 0x07, 0x87, 0x00,
+    0x00, 0x00, 0x81, 0x70, 0x86, 0x0e, 0x81, 0xf0, 0x86, 0x00, 0x01, 0xe0,     // "?"
+    0xe0, 0x81, 0x1c, 0x81, 0x03, 0x86, 0x00, 0x01, 0x38, 0x38, 0x85, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x00, 0x0e, 0x82, 0x8e, 0x02, 0x0e, 0x0e, 0x8e,     // "@"
+    0x81, 0xf0, 0x01, 0x00, 0x00, 0x81, 0xff, 0x00, 0x00, 0x81, 0xff, 0x03,
+    0xe3, 0xe2, 0xe2, 0x83, 0x81, 0xff, 0x04, 0x00, 0x00, 0x07, 0x07, 0x3f,
+    0x85, 0x38, 0x00, 0x3b, 0x81, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "A"
+    0xff, 0x86, 0x1c, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x00,
+    0x81, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "B"
+    0xff, 0x86, 0x1c, 0x81, 0xe3, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x38,
+    0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x86, 0x0e, 0x81, 0x70, 0x01, 0x00, 0x00, 0x81,     // "C"
+    0xff, 0x8b, 0x00, 0x81, 0x07, 0x86, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "D"
+    0xff, 0x86, 0x00, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x38,
+    0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x89, 0x0e, 0x01, 0x00, 0x00, 0x81, 0xff, 0x86,     // "E"
+    0x1c, 0x83, 0x00, 0x81, 0x3f, 0x89, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x89, 0x0e, 0x01, 0x00, 0x00, 0x81, 0xff, 0x86,     // "F"
+    0x1c, 0x83, 0x00, 0x81, 0x3f, 0x8a, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x86, 0x0e, 0x81, 0x70, 0x01, 0x00, 0x00, 0x81,     // "G"
+    0xff, 0x81, 0x00, 0x83, 0x1c, 0x81, 0xfc, 0x01, 0x00, 0x00, 0x81, 0x07,
+    0x86, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x00, 0x81, 0xfe, 0x01, 0x00, 0x00, 0x81,     // "H"
+    0xff, 0x86, 0x1c, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x00,
+    0x81, 0x3f, 0x00, 0x00,
+    0x81, 0x00, 0x82, 0x0e, 0x01, 0xfe, 0xfe, 0x82, 0x0e, 0x88, 0x00, 0x01,     // "I"
+    0xff, 0xff, 0x88, 0x00, 0x82, 0x38, 0x01, 0x3f, 0x3f, 0x82, 0x38, 0x81,
+    0x00,
+    0x82, 0x00, 0x82, 0x0e, 0x81, 0xfe, 0x82, 0x0e, 0x87, 0x00, 0x81, 0xff,     // "J"
+    0x84, 0x00, 0x81, 0x07, 0x82, 0x38, 0x81, 0x07, 0x83, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x81, 0x00, 0x01, 0x80, 0x80, 0x81, 0x70, 0x81,     // "K"
+    0x0e, 0x01, 0x00, 0x00, 0x81, 0xff, 0x81, 0x1c, 0x01, 0xe3, 0xe3, 0x86,
+    0x00, 0x81, 0x3f, 0x83, 0x00, 0x81, 0x07, 0x81, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x8b, 0x00, 0x81, 0xff, 0x8b, 0x00, 0x81, 0x3f,     // "L"
+    0x89, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x81, 0x70, 0x01, 0x80, 0x80, 0x81, 0x70, 0x81,     // "M"
+    0xfe, 0x01, 0x00, 0x00, 0x81, 0xff, 0x81, 0x00, 0x01, 0x03, 0x03, 0x81,
+    0x00, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x00, 0x81, 0x3f,
+    0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x81, 0x80, 0x83, 0x00, 0x81, 0xfe, 0x01, 0x00,     // "N"
+    0x00, 0x81, 0xff, 0x81, 0x03, 0x01, 0x1c, 0x1c, 0x81, 0xe0, 0x81, 0xff,
+    0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x00, 0x81, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "O"
+    0xff, 0x86, 0x00, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38,
+    0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "P"
+    0xff, 0x86, 0x1c, 0x81, 0x03, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x8a, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "Q"
+    0xff, 0x81, 0x00, 0x01, 0xe0, 0xe0, 0x81, 0x00, 0x81, 0xff, 0x01, 0x00,
+    0x00, 0x81, 0x07, 0x83, 0x38, 0x81, 0x07, 0x81, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x0e, 0x81, 0xf0, 0x01, 0x00, 0x00, 0x81,     // "R"
+    0xff, 0x86, 0x1c, 0x81, 0xe3, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x00,
+    0x81, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xf0, 0x89, 0x0e, 0x01, 0x00, 0x00, 0x81, 0x03, 0x86,     // "S"
+    0x1c, 0x81, 0xe0, 0x01, 0x00, 0x00, 0x89, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x84, 0x0e, 0x01, 0xfe, 0xfe, 0x84, 0x0e, 0x86, 0x00, 0x01,     // "T"
+    0xff, 0xff, 0x8c, 0x00, 0x01, 0x3f, 0x3f, 0x85, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x00, 0x81, 0xfe, 0x01, 0x00, 0x00, 0x81,     // "U"
+    0xff, 0x86, 0x00, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38,
+    0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x00, 0x81, 0xfe, 0x01, 0x00, 0x00, 0x81,     // "V"
+    0xff, 0x86, 0x00, 0x81, 0xff, 0x83, 0x00, 0x81, 0x07, 0x01, 0x38, 0x38,
+    0x81, 0x07, 0x82, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x00, 0x81, 0xfe, 0x01, 0x00, 0x00, 0x81,     // "W"
+    0xff, 0x81, 0x00, 0x01, 0x80, 0x80, 0x81, 0x00, 0x81, 0xff, 0x01, 0x00,
+    0x00, 0x81, 0x07, 0x81, 0x38, 0x01, 0x07, 0x07, 0x81, 0x38, 0x81, 0x07,
+    0x00, 0x00,
+    0x00, 0x00, 0x81, 0x7e, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81, 0x80, 0x81,     // "X"
+    0x7e, 0x83, 0x00, 0x81, 0xe3, 0x01, 0x1c, 0x1c, 0x81, 0xe3, 0x83, 0x00,
+    0x81, 0x3f, 0x86, 0x00, 0x81, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x86, 0x00, 0x81, 0xfe, 0x01, 0x00, 0x00, 0x81,     // "Y"
+    0x03, 0x81, 0x1c, 0x01, 0xe0, 0xe0, 0x81, 0x1c, 0x81, 0x03, 0x86, 0x00,
+    0x01, 0x3f, 0x3f, 0x85, 0x00,
+    0x00, 0x00, 0x86, 0x0e, 0x81, 0x8e, 0x81, 0x7e, 0x83, 0x00, 0x81, 0xe0,     // "Z"
+    0x01, 0x1c, 0x1c, 0x81, 0x03, 0x83, 0x00, 0x81, 0x3f, 0x89, 0x38, 0x00,
+    0x00,
+    0x82, 0x00, 0x81, 0xfe, 0x83, 0x0e, 0x86, 0x00, 0x81, 0xff, 0x8b, 0x00,     // "["
+    0x81, 0x3f, 0x83, 0x38, 0x82, 0x00,
+    0x81, 0x00, 0x01, 0x3e, 0x3e, 0x81, 0xc0, 0x8b, 0x00, 0x81, 0x0f, 0x81,     // "\"
+    0xf0, 0x8b, 0x00, 0x81, 0x03, 0x01, 0x3c, 0x3c, 0x81, 0x00,
+    0x82, 0x00, 0x83, 0x0e, 0x81, 0xfe, 0x8b, 0x00, 0x81, 0xff, 0x86, 0x00,     // "]"
+    0x83, 0x38, 0x81, 0x3f, 0x82, 0x00,
+    0x82, 0x00, 0x81, 0x70, 0x01, 0x0e, 0x0e, 0x81, 0x70, 0xa2, 0x00,           // "^"
+    0x9f, 0x00, 0x8c, 0x38, 0x00, 0x00,                                         // "_"
+    0x83, 0x00, 0x81, 0x0e, 0x81, 0x70, 0xa3, 0x00,                             // "`"
+    0x82, 0x00, 0x86, 0x80, 0x86, 0x00, 0x86, 0xe3, 0x81, 0xfc, 0x01, 0x00,     // "a"
+    0x00, 0x81, 0x07, 0x86, 0x38, 0x81, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x81, 0x00, 0x83, 0x80, 0x83, 0x00, 0x81, 0xff,     // "b"
+    0x81, 0x1c, 0x83, 0x03, 0x81, 0xfc, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86,
+    0x38, 0x81, 0x07, 0x00, 0x00,
+    0x82, 0x00, 0x86, 0x80, 0x83, 0x00, 0x81, 0xfc, 0x86, 0x03, 0x81, 0x1c,     // "c"
+    0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x82, 0x00, 0x83, 0x80, 0x81, 0x00, 0x81, 0xfe, 0x01, 0x00, 0x00, 0x81,     // "d"
+    0xfc, 0x83, 0x03, 0x81, 0x1c, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x07,
+    0x86, 0x38, 0x81, 0x3f, 0x00, 0x00,
+    0x82, 0x00, 0x86, 0x80, 0x83, 0x00, 0x81, 0xfc, 0x86, 0xe3, 0x81, 0xfc,     // "e"
+    0x01, 0x00, 0x00, 0x81, 0x07, 0x89, 0x38, 0x00, 0x00,
+    0x82, 0x00, 0x81, 0xf0, 0x83, 0x0e, 0x81, 0x70, 0x01, 0x00, 0x00, 0x81,     // "f"
+    0x1c, 0x81, 0xff, 0x83, 0x1c, 0x86, 0x00, 0x81, 0x3f, 0x87, 0x00,
+    0x82, 0x00, 0x85, 0x80, 0x00, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81,     // "g"
+    0x7c, 0x85, 0x83, 0x00, 0x9c, 0x81, 0xff, 0x83, 0x00, 0x86, 0x3b, 0x81,
+    0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x8b, 0x00, 0x81, 0xff, 0x81, 0xe0, 0x83, 0x1c,     // "h"
+    0x81, 0xe0, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86, 0x00, 0x81, 0x3f, 0x00,
+    0x00,
+    0x82, 0x00, 0x81, 0x80, 0x01, 0x8e, 0x8e, 0x89, 0x00, 0x81, 0x03, 0x01,     // "i"
+    0xff, 0xff, 0x89, 0x00, 0x81, 0x38, 0x01, 0x3f, 0x3f, 0x81, 0x38, 0x82,
+    0x00,
+    0x89, 0x00, 0x01, 0x8e, 0x8e, 0x8c, 0x00, 0x01, 0xff, 0xff, 0x84, 0x00,     // "j"
+    0x01, 0x07, 0x07, 0x84, 0x38, 0x01, 0x07, 0x07, 0x81, 0x00,
+    0x00, 0x00, 0x81, 0xfe, 0x85, 0x00, 0x01, 0x80, 0x80, 0x82, 0x00, 0x81,     // "k"
+    0xff, 0x82, 0xe0, 0x81, 0x1c, 0x01, 0x03, 0x03, 0x82, 0x00, 0x81, 0x3f,
+    0x82, 0x00, 0x81, 0x07, 0x01, 0x38, 0x38, 0x81, 0x00,
+    0x82, 0x00, 0x81, 0x0e, 0x01, 0xfe, 0xfe, 0x8c, 0x00, 0x01, 0xff, 0xff,     // "l"
+    0x89, 0x00, 0x81, 0x38, 0x01, 0x3f, 0x3f, 0x81, 0x38, 0x82, 0x00,
+    0x00, 0x00, 0x84, 0x80, 0x01, 0x00, 0x00, 0x81, 0x80, 0x83, 0x00, 0x81,     // "m"
+    0xff, 0x81, 0x03, 0x01, 0x7c, 0x7c, 0x81, 0x03, 0x81, 0xfc, 0x01, 0x00,
+    0x00, 0x81, 0x3f, 0x86, 0x00, 0x81, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x81, 0x00, 0x83, 0x80, 0x83, 0x00, 0x81, 0xff,     // "n"
+    0x81, 0x1c, 0x83, 0x03, 0x81, 0xfc, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86,
+    0x00, 0x81, 0x3f, 0x00, 0x00,
+    0x82, 0x00, 0x86, 0x80, 0x83, 0x00, 0x81, 0xfc, 0x86, 0x03, 0x81, 0xfc,     // "o"
+    0x01, 0x00, 0x00, 0x81, 0x07, 0x86, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x00, 0x00, 0x85, 0x80, 0x83, 0x00, 0x81, 0xff,     // "p"
+    0x00, 0x9c, 0x85, 0x83, 0x81, 0x7c, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x86,
+    0x03, 0x82, 0x00,
+    0x82, 0x00, 0x85, 0x80, 0x00, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81,     // "q"
+    0x7c, 0x85, 0x83, 0x00, 0x9c, 0x81, 0xff, 0x83, 0x00, 0x86, 0x03, 0x81,
+    0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x81, 0x00, 0x83, 0x80, 0x83, 0x00, 0x81, 0xff,     // "r"
+    0x81, 0x1c, 0x83, 0x03, 0x81, 0x1c, 0x01, 0x00, 0x00, 0x81, 0x3f, 0x8a,
+    0x00,
+    0x82, 0x00, 0x87, 0x80, 0x82, 0x00, 0x81, 0x1c, 0x86, 0xe3, 0x00, 0x03,     // "s"
+    0x84, 0x00, 0x87, 0x38, 0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x81, 0xf0, 0x01, 0x80, 0x80, 0x86, 0x00, 0x81,     // "t"
+    0x03, 0x81, 0xff, 0x01, 0x03, 0x03, 0x89, 0x00, 0x81, 0x07, 0x83, 0x38,
+    0x81, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x86, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81,     // "u"
+    0xff, 0x86, 0x00, 0x81, 0xff, 0x01, 0x00, 0x00, 0x81, 0x07, 0x83, 0x38,
+    0x81, 0x07, 0x81, 0x3f, 0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x86, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81,     // "v"
+    0xff, 0x86, 0x00, 0x81, 0xff, 0x83, 0x00, 0x81, 0x07, 0x01, 0x38, 0x38,
+    0x81, 0x07, 0x82, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x86, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81,     // "w"
+    0xff, 0x81, 0x00, 0x01, 0x80, 0x80, 0x81, 0x00, 0x81, 0xff, 0x01, 0x00,
+    0x00, 0x81, 0x07, 0x81, 0x38, 0x01, 0x07, 0x07, 0x81, 0x38, 0x81, 0x07,
+    0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x86, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81,     // "x"
+    0x03, 0x81, 0x1c, 0x01, 0xe0, 0xe0, 0x81, 0x1c, 0x81, 0x03, 0x01, 0x00,
+    0x00, 0x81, 0x38, 0x81, 0x07, 0x01, 0x00, 0x00, 0x81, 0x07, 0x81, 0x38,
+    0x00, 0x00,
+    0x00, 0x00, 0x81, 0x80, 0x86, 0x00, 0x81, 0x80, 0x01, 0x00, 0x00, 0x81,     // "y"
+    0x1f, 0x86, 0xe0, 0x81, 0xff, 0x83, 0x00, 0x86, 0x38, 0x81, 0x07, 0x00,
+    0x00,
+    0x00, 0x00, 0x8c, 0x80, 0x01, 0x00, 0x00, 0x84, 0x03, 0x01, 0xe3, 0xe3,     // "z"
+    0x81, 0x1f, 0x81, 0x03, 0x01, 0x00, 0x00, 0x81, 0x38, 0x81, 0x3f, 0x86,
+    0x38, 0x00, 0x00,
+    0x85, 0x00, 0x01, 0xf0, 0xf0, 0x81, 0x0e, 0x86, 0x00, 0x81, 0x1c, 0x01,     // "{"
+    0xe3, 0xe3, 0x8c, 0x00, 0x01, 0x07, 0x07, 0x81, 0x38, 0x82, 0x00,
+    0x85, 0x00, 0x01, 0xfe, 0xfe, 0x8c, 0x00, 0x01, 0xff, 0xff, 0x8c, 0x00,     // "|"
+    0x01, 0x3f, 0x3f, 0x85, 0x00,
+    0x82, 0x00, 0x81, 0x0e, 0x01, 0xf0, 0xf0, 0x8c, 0x00, 0x01, 0xe3, 0xe3,     // "}"
+    0x81, 0x1c, 0x86, 0x00, 0x81, 0x38, 0x01, 0x07, 0x07, 0x85, 0x00,
+    0x8f, 0x00, 0x81, 0x70, 0x82, 0x0e, 0x82, 0x70, 0x81, 0x0e, 0x8f, 0x00     // "~"
+};
+
+const font_t font16x24RLE = {.encoding = FONT_RLE, .height = 24, .first = ' ', .last = '~', .widths = font16x24RLEWidths, .offsets = font16x24RLEOffsets, .bitmaps = font16x24RLEBitmaps};
+
+//========================================
+// END OF FILE
+//========================================
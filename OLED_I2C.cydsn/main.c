@@ -2,6 +2,7 @@
 // include                                         
 //======================================
 #include "oled.h"
+#include "oled_i2c.h"
 
 //======================================
 // function declarations                                       
@@ -31,9 +32,10 @@ int main(void)
 //========================================
 void DemoGraphics()
 {
-    oled_t oled;
+    static oled_t oled;             // static: the stack is only 2 KB
+    static oled_i2c_t i2c;          // I2C transport
     uint8 slaveAddr = 0x3c;         // OLED slave address
-    oled_Init(&oled, slaveAddr, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte);   // initialize OLED
+    oled_Init(&oled, oled_I2CTransport(&i2c, slaveAddr, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte), OLED_UPDATE_IMMEDIATE);   // initialize OLED
     oled_SetPenSize(&oled, 1);      // set pen size to 1
     int delay = 1000;
     for (;;){
@@ -80,11 +82,13 @@ void DemoGraphics()
 //========================================
 void DemoText(void)
 {
-    oled_t oled;
+    static oled_t oled;             // static: the stack is only 2 KB
+    static oled_i2c_t i2c;          // I2C transport
     uint8 slaveAddr = 0x3c;         // OLED slave address
-    oled_Init(&oled, slaveAddr, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte);   // initialize OLED
+    oled_Init(&oled, oled_I2CTransport(&i2c, slaveAddr, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte), OLED_UPDATE_DEFERRED);    // initialize OLED (drawing only modifies GRAM)
     oled_Clear(&oled);
     oled_DispString(&oled, 0, 0, "WELCOME\nTO\nELECTRONIX\nFIRST");
+    oled_Flush(&oled);              // send the text to the display
 }
 
 //========================================
@@ -92,9 +96,10 @@ void DemoText(void)
 //========================================
 void DemoBitmap(void)
 {
-    oled_t oled;
+    static oled_t oled;                     // static: the stack is only 2 KB
+    static oled_i2c_t i2c;                  // I2C transport
     uint8 slaveAddr = 0x3c;                 // OLED slave address
-    oled_Init(&oled, slaveAddr, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte);   // initialize OLED
+    oled_Init(&oled, oled_I2CTransport(&i2c, slaveAddr, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte), OLED_UPDATE_IMMEDIATE);   // initialize OLED
     oled_Clear(&oled);
     int MIT_width = 64, MIT_height = 38;    // height and width of bitmap
     static unsigned char MIT_bits[] = {
@@ -1,29 +1,140 @@
 //======================================
 // include                                         
 //======================================
+#include <stdint.h>
+#include <string.h>
 #include "oled.h"
 
+//======================================
+// RLE decoder (see oled_DispRLEBitmap())
+//======================================
+typedef struct {
+    const uint8 * src;      // next byte of the compressed data
+    uint8 left;             // bytes of the current packet still to be expanded
+    uint8 repeat;           // 1 if the current packet is one byte repeated
+} rle_t;
+
+//======================================
+// GRAM words (see FILL_KERNEL())
+//======================================
+typedef uint32 __attribute__((may_alias)) gram_word_t;    // 4 bytes of GRAM, allowed to alias the uint8 buffer
+
+//======================================
+// line spans (see BresenhamLineAlgorithm())
+//======================================
+typedef struct {
+    uint8 vertical;         // 1 if the spans are columns (steep lines), 0 if they are rows
+    int16 s0[OLED_WIDTH];   // first pixel of the span on each row (column)
+    int16 s1[OLED_WIDTH];   // last pixel of the span on each row (column), s1 < s0 if the row is empty
+} span_t;
+
+//======================================
+// sectors (see oled_DrawArcAngle())
+//======================================
+typedef struct {
+    int cos0, sin0;         // direction of the start of the sector (1.0 = 16384)
+    int cos1, sin1;         // direction of the end of the sector
+    uint8 wide;             // 1 if the sector is wider than half a turn
+} sector_t;
+
+//======================================
+// polygon edges (see oled_FillPolygon())
+//======================================
+typedef struct {
+    int32 x0, y0;           // top end (display coordinates, which need not fit in 16 bits)
+    int32 x1, y1;           // bottom end
+} edge_t;
+
+//======================================
+// ellipses (see MidpointEllipseAlgorithm())
+//======================================
+typedef struct {
+    int32 a2, b2;           // squares of the horizontal and vertical radii
+    int32 p;                // decision parameter (4 times the midpoint's value)
+    int a;                  // horizontal radius
+    int x, y;               // current point (first quadrant, relative to the center)
+    uint8 region;           // 1 while the slope is under -1, then 2
+} ellipse_t;
+
+//======================================
+// scratch buffers
+//======================================
+// Kept out of the functions that fill them:
+// the stack is only 2 KB and usually holds
+// the oled_t as well. Drawing functions do
+// not nest, so one of each is enough
+//======================================
+static span_t lineSpan;                                 // rows (columns) of the line being drawn (see BresenhamLineAlgorithm())
+static oled_spans_t circleSpans;                        // spans of an ellipse, or of a circle that is not cached (see RoundedCircleAlgorithm())
+static edge_t polygonEdges[OLED_POLYGON_POINTS];        // edge table of the polygon being drawn (see ScanPolygon())
+static uint8 polygonActive[OLED_POLYGON_POINTS];        // edges crossing its current row
+static int16 polygonSpans[2*OLED_POLYGON_POINTS][2];    // spans of its current row
+static int16 polygonCross[OLED_POLYGON_POINTS];         // columns at which its edges cross the middle of the row (see PolygonRow())
+
 //======================================
 // private function declarations                                        
 //======================================
-void SetColumnAddress(oled_t * oled, uint8 A, uint8 B);
-void SetPageAddress(oled_t * oled, uint8 A, uint8 B);
+void OpenWindow(oled_t * oled, int x0, int p0, int x1, int p1);
 void WriteGRAM(oled_t * oled, int x0, int y0, int x1, int y1, uint8 color);
+void FillGRAM(oled_t * oled, int x0, int y0, int x1, int y1, uint8 color);
+void SetBytes(uint8 * p, int n, uint8 bits);
+void ClearBytes(uint8 * p, int n, uint8 bits);
+void InvertBytes(uint8 * p, int n, uint8 bits);
+uint8 RasterOp(oled_t * oled, uint8 color);
+void UpdateDisplay(oled_t * oled, int x0, int p0, int x1, int p1);
+void UpdatePages(oled_t * oled, const uint8 * x0, const uint8 * x1);
+void SendPages(oled_t * oled, const uint8 * x0, const uint8 * x1);
+void SendGRAM(oled_t * oled, int x0, int p0, int x1, int p1);
+void MarkClean(oled_t * oled, int p0, int p1);
+void QueueGRAM(oled_t * oled, int x0, int p0, int x1, int p1);
+void UpdateShadow(oled_t * oled, int offset, int count);
+void TransposeTile(const uint8 * rows, int stride, int count, uint8 * cols);
+uint8 BlendGRAM(oled_t * oled, int x, int p, uint8 bits, uint8 mask);
+void BlitColumn(oled_t * oled, int x, int p, int shift, uint8 bits, uint8 mask, int * block);
+void GrowBlock(int * block, int x, int p);
+void DispLine(oled_t * oled, int x0, int y0, const char * s, int n);
+void GlyphPage(const font_t * font, int i, int t, int c0, int c1, uint8 * cols);
+int CharWidth(const font_t * font, char c);
+uint8 RLENext(rle_t * rle);
+void RLESkip(rle_t * rle, int count);
 void DrawHLine(oled_t * oled, int y, int x0, int x1);
 void DrawVLine(oled_t * oled, int x, int y0, int y1);
 void BresenhamLineAlgorithm(oled_t * oled, int x0, int y0, int dx, int dy, uint8 rot);
-void PlotPerpLineL(oled_t * oled, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot);
-void PlotPerpLineR(oled_t * oled, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot);
-void PlotPoint(oled_t * oled, int x0, int y0, int x, int y, uint8 rot);
-void BresenhamCircleAlgorithm(oled_t *oled, int xc, int yc, int rIn, int rOut, uint8 octants);
-void PlotCircle(oled_t * oled, int xc, int yc, int x, int yIn, int yOut, uint8 octants);
+void PlotPerpLineL(oled_t * oled, span_t * span, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot);
+void PlotPerpLineR(oled_t * oled, span_t * span, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot);
+void PlotPoint(span_t * span, int x0, int y0, int x, int y, uint8 rot);
+void AddToSpan(span_t * span, int x, int y);
+void DrawSpans(oled_t * oled, span_t * span);
+void FillRow(oled_t * oled, int y, int x0, int x1, uint8 op, uint8 * px0, uint8 * px1);
+void BresenhamCircleAlgorithm(oled_t *oled, int xc, int yc, int rIn, int rOut, uint8 octants, const sector_t * sector);
+void RoundedCircleAlgorithm(oled_t * oled, int xl, int yt, int xr, int yb, int rIn, int rOut, uint8 octants, const sector_t * sector);
+oled_spans_t * CachedSpans(oled_t * oled, int rIn, int rOut, uint8 octants);
+void CircleSpans(oled_spans_t * spans, int rIn, int rOut, uint8 octants);
+void PlotCircle(oled_spans_t * spans, int x, int yIn, int yOut, uint8 octants);
+void AddToHalf(const oled_spans_t * spans, int16 (*half)[2], int y0, int y1, int x0, int x1);
+void DrawCircleSpans(oled_t * oled, int x0, int y0, int x1, int y1, const oled_spans_t * spans, const sector_t * sector);
+void MidpointEllipseAlgorithm(oled_t * oled, int xc, int yc, int rxIn, int ryIn, int rxOut, int ryOut);
+void EllipseSpans(oled_spans_t * spans, int rxIn, int ryIn, int rxOut, int ryOut);
+void EllipseStart(ellipse_t * e, int a, int b);
+int EllipseRow(ellipse_t * e);
+void MakeSector(sector_t * sector, uint16 a0, uint16 a1);
+int SectorRow(const sector_t * sector, int y, int * lo, int * hi);
+void HalfPlane(int ux, int uy, int y, int * lo, int * hi);
+void ScanPolygon(oled_t * oled, const int16 * points, int n, uint8 fill);
+void EdgeTable(oled_t * oled, const int16 * points, int n, edge_t * edges);
+int PolygonRow(const edge_t * edges, const uint8 * active, int m, int y, uint8 fill, int16 (*spans)[2]);
+void EdgeRun(const edge_t * e, int y, int * a, int * b);
+int EdgeX(const edge_t * e, int t);
+int64 EdgeAt(const edge_t * e, int t, uint8 round);
+int EdgeColumn(int64 x);
+int Sine(uint16 a);
+int FloorDiv(int a, int b);
 void Swap(int* var0, int* var1);
 
 //======================================
 // initialization commands for ssd1306 driver                             
 //======================================
 const uint8 initCmds[] = {
-    0x00,
     SSD1306_CHARGEPUMP,
     0x14,
     SSD1306_SEGREMAP | 0x1,
@@ -33,6 +144,22 @@ const uint8 initCmds[] = {
     0x00
 };
 
+//======================================
+// sine of 0 to 90 degrees in 64 steps, for
+// arcs and pies at any angle (16384 = 1.0)
+//======================================
+const int16 sineTable[65] = {
+        0,   402,   804,  1205,  1606,  2006,  2404,  2801,
+     3196,  3590,  3981,  4370,  4756,  5139,  5520,  5897,
+     6270,  6639,  7005,  7366,  7723,  8076,  8423,  8765,
+     9102,  9434,  9760, 10080, 10394, 10702, 11003, 11297,
+    11585, 11866, 12140, 12406, 12665, 12916, 13160, 13395,
+    13623, 13842, 14053, 14256, 14449, 14635, 14811, 14978,
+    15137, 15286, 15426, 15557, 15679, 15791, 15893, 15986,
+    16069, 16143, 16207, 16261, 16305, 16340, 16364, 16379,
+    16384
+};
+
 //======================================
 // oled_Init()
 // this function initializes the oled_t struct
@@ -41,29 +168,374 @@ const uint8 initCmds[] = {
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     slaveAddr - 7-bit I2C address
-//     SendStart - function pointer to I2C_MasterSendStart()
-//     SendStop - function pointer to I2C_MasterSendStop()
-//     WriteByte - function pointer to I2C_MasterWriteByte()
+//     transport - pointer to the transport connecting
+//                 the display (e.g. from oled_I2CTransport())
+//     updateMode - OLED_UPDATE_IMMEDIATE or OLED_UPDATE_DEFERRED
 //======================================
-void oled_Init(oled_t * oled, uint8 slaveAddr, uint8 (*SendStart)(uint8, uint8), uint8 (*SendStop)(void), uint8 (*WriteByte)(uint8))
+void oled_Init(oled_t * oled, oled_transport_t * transport, uint8 updateMode)
 {
-    oled->slaveAddr = slaveAddr;                    // set oled's I2C address
-    oled->SendStart = SendStart;                    // pass oled the I2C_MasterSendStart() function
-    oled->SendStop = SendStop;                      // pass oled the I2C_MasterSendStop() function
-    oled->WriteByte = WriteByte;                    // pass oled the I2C_MasterWriteByte() function
+    oled->transport = transport;                    // set the transport used to reach the display
+    oled->OnComplete = NULL;
     oled->bkColor = 0;                              // set background color
     oled->color = 1;                                // set foreground color
     oled->penSize = 0;                              // set pen size
     oled->font = &font;                             // set font
     oled->bmMode = OLED_BM_NORMAL;                  // set bitmap mode
     oled->textMode = OLED_TEXT_TRAN;                // set text mode
+    oled->rop = OLED_ROP_COPY;                      // set raster operation
+    oled->GRAM = oled->buffer;                      // single buffered
+    oled->txGRAM = oled->buffer;
+    oled->updateMode = OLED_UPDATE_IMMEDIATE;       // set update mode
+    if (updateMode == OLED_UPDATE_DEFERRED) oled->updateMode = updateMode;
+    oled->shadow = NULL;                            // no shadow copy of the display
+    oled->shadowValid = 0;
+    oled->spanCache = NULL;                         // no circle span cache
+    oled->spanCacheSize = 0;
+    oled->clipDepth = 0;                            // the whole display is the viewport
+    oled_PopClip(oled);
+    MarkClean(oled, 0, OLED_HEIGHT/8 - 1);          // nothing to flush yet
+    for (int i=0; i<OLED_HEIGHT/8; i++){
+        oled->prevX0[i] = OLED_WIDTH - 1;
+        oled->prevX1[i] = 0;
+    }
+    for (int i=0; i<OLED_HEIGHT/8; i++){            // nothing queued
+        oled->queueX0[i] = OLED_WIDTH - 1;
+        oled->queueX1[i] = 0;
+    }
+    oled->queuePage = 0;
+    oled->txFrame = OLED_GRAM_SIZE;
+    oled->txDone = 0;
+
+    transport->WriteCmds(transport->bus, initCmds, sizeof(initCmds));   // send initialization commands/parameters
+    transport->Flush(transport->bus);
+    while (oled_IsBusy(oled));                      // wait for a background transport to finish
+}
+
+//========================================
+// oled_Flush()
+// this function sends all changes made to
+// GRAM since the last flush to the display.
+// Only needed in OLED_UPDATE_DEFERRED mode
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_Flush(oled_t * oled)
+{
+    SendPages(oled, oled->dirtyX0, oled->dirtyX1);      // send the dirty columns of every page
+    MarkClean(oled, 0, OLED_HEIGHT/8 - 1);              // GRAM and display now match
+}
+
+//========================================
+// oled_FlushRect()
+// this function sends the rectangle of GRAM
+// defined by its upper left corner (x0, y0) 
+// and lower right corner (x1, y1) to the
+// display. The rectangle is rounded out to
+// whole pages (multiples of 8 rows)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//========================================
+void oled_FlushRect(oled_t * oled, int x0, int y0, int x1, int y1)
+{
+    if (x0 < 0) x0 = 0;                                 // ensure x0, y0, x1, y1 are within display bounds
+    if (x1 > OLED_WIDTH - 1) x1 = OLED_WIDTH - 1;
+    if (x1 < x0) return;                                                
+    if (y0 < 0) y0 = 0;
+    if (y1 > OLED_HEIGHT - 1) y1 = OLED_HEIGHT - 1;
+    if (y1 < y0) return;
+
+    SendGRAM(oled, x0, y0/8, x1, y1/8);                 // send rectangle
+
+    for (int i=y0/8; i<=y1/8; i++){                     // pages whose modified columns were all sent are now clean
+        if ((x0 <= oled->dirtyX0[i]) && (x1 >= oled->dirtyX1[i])) MarkClean(oled, i, i);
+    }
+}
+
+//========================================
+// oled_SetShadow()
+// this function gives the oled a buffer in
+// which to keep a copy of what the display
+// holds (everything sent to it). The buffer
+// is needed by oled_Sync(). The first 
+// oled_Sync() after this call sends the 
+// whole screen
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     shadow - pointer to an array of 
+//              OLED_WIDTH*(OLED_HEIGHT/8) bytes,
+//              or NULL to stop using it
+//========================================
+void oled_SetShadow(oled_t * oled, uint8 * shadow)
+{
+    oled->shadow = shadow;
+    oled->shadowValid = 0;                              // the display's contents are unknown until the whole screen has been sent
+}
+
+//========================================
+// oled_Sync()
+// this function sends only the bytes of GRAM
+// that differ from what the display holds.
+// Runs of changed bytes that are close together
+// are sent as one window when that is cheaper
+// than opening a new one. Use in place of 
+// oled_Flush() when each frame is redrawn from 
+// scratch (i.e. oled_Clear() followed by 
+// drawing). Without a shadow buffer (see 
+// oled_SetShadow()) this is the same as 
+// oled_Flush()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_Sync(oled_t * oled)
+{
+    if (oled->shadow == NULL){
+        oled_Flush(oled);
+        return;
+    }
+    if (oled->shadowValid == 0){                        // nothing to compare against yet
+        SendGRAM(oled, 0, 0, OLED_WIDTH-1, OLED_HEIGHT/8 - 1);
+        oled->shadowValid = 1;
+        MarkClean(oled, 0, OLED_HEIGHT/8 - 1);
+        return;
+    }
+    int x0, x1;                                         // current run of changed bytes (x0 < 0 if there is none)
+    for (int i=0; i<OLED_HEIGHT/8; i++){                // iterate over pages
+        x0 = -1;
+        x1 = -1;
+        for (int j=oled->dirtyX0[i]; j<=oled->dirtyX1[i]; j++){         // bytes outside the dirty columns have not changed since they were sent
+            if (oled->txGRAM[i*OLED_WIDTH + j] == oled->shadow[i*OLED_WIDTH + j]) continue;
+            if ((x0 >= 0) && (j - x1 - 1 > oled->transport->windowCost)){          // resending the unchanged gap costs more than a new window
+                SendGRAM(oled, x0, i, x1, i);
+                x0 = -1;
+            }
+            if (x0 < 0) x0 = j;
+            x1 = j;
+        }
+        if (x0 >= 0) SendGRAM(oled, x0, i, x1, i);
+    }
+    MarkClean(oled, 0, OLED_HEIGHT/8 - 1);              // GRAM and display now match
+}
+
+//========================================
+// oled_SetTransport()
+// this function switches the oled to another
+// transport (e.g. from blocking to interrupt
+// driven I2C transfers) once everything queued
+// on the current one has been sent. With a
+// transport that sends in the background, 
+// functions that update the display queue the
+// modified columns of each page and return 
+// immediately. Queued pages are sent one 
+// transfer at a time by oled_IsBusy(). When
+// every page is queued in full, the whole frame
+// is sent as one window followed by a chain of
+// data only transfers
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     transport - pointer to the new transport
+//========================================
+void oled_SetTransport(oled_t * oled, oled_transport_t * transport)
+{
+    while (oled_IsBusy(oled));                          // finish whatever is queued with the current transport
+    oled->transport = transport;
+}
+
+//========================================
+// oled_SetOnComplete()
+// this function sets a function to be called
+// (from oled_IsBusy()) each time the queue of
+// background transfers has been emptied
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     OnComplete - completion callback, or NULL
+//========================================
+void oled_SetOnComplete(oled_t * oled, void (*OnComplete)(oled_t *))
+{
+    oled->OnComplete = OnComplete;
+}
+
+//========================================
+// oled_IsBusy()
+// this function returns 1 while background
+// transfers are in progress or queued, 0 otherwise.
+// Each call also starts the next queued transfer
+// once the bus is free, so it should be called 
+// regularly (e.g. once per pass of the main loop)
+// until it returns 0
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+uint8 oled_IsBusy(oled_t * oled)
+{
+    oled_transport_t * t = oled->transport;
+    if (t->Busy == NULL) return 0;                      // blocking transfers are complete when they return
+    if (t->Busy(t->bus)) return 1;                      // the last transfer is still on the bus
+
+    uint16 n;
+    if (oled->txFrame < OLED_GRAM_SIZE){                // a full frame is being transferred: continue with a data only transfer
+        n = t->WriteData(t->bus, &oled->txGRAM[oled->txFrame], OLED_GRAM_SIZE - oled->txFrame);
+        t->Flush(t->bus);
+        UpdateShadow(oled, oled->txFrame, n);
+        oled->txFrame += n;
+        return 1;
+    }
+
+    uint8 full = 1;                                     // check if every page is queued in full
+    for (int i=0; i<OLED_HEIGHT/8; i++){
+        if ((oled->queueX0[i] != 0) || (oled->queueX1[i] != OLED_WIDTH - 1)) full = 0;
+    }
+    if (full){                                          // open one window for the whole frame and send as much of it as fits, the rest follows in data only transfers
+        OpenWindow(oled, 0, 0, OLED_WIDTH - 1, OLED_HEIGHT/8 - 1);
+        n = t->WriteData(t->bus, oled->txGRAM, OLED_GRAM_SIZE);
+        t->Flush(t->bus);
+        UpdateShadow(oled, 0, n);
+        for (int i=0; i<OLED_HEIGHT/8; i++){            // nothing is queued anymore
+            oled->queueX0[i] = OLED_WIDTH - 1;
+            oled->queueX1[i] = 0;
+        }
+        oled->txFrame = n;
+        oled->txDone = 1;
+        return 1;
+    }
+
+    for (int k=0; k<OLED_HEIGHT/8; k++){                // look for a queued page, starting after the last one sent so that no page waits forever
+        int i = (oled->queuePage + k) % (OLED_HEIGHT/8);
+        int x0 = oled->queueX0[i];
+        int x1 = oled->queueX1[i];
+        if (x1 < x0) continue;
+
+        OpenWindow(oled, x0, i, x1, i);                 // window commands followed by the page's queued columns
+        n = t->WriteData(t->bus, &oled->txGRAM[i*OLED_WIDTH + x0], x1 - x0 + 1);
+        t->Flush(t->bus);
+        UpdateShadow(oled, i*OLED_WIDTH + x0, n);
+        if (x0 + n <= x1){                              // columns that did not fit stay queued
+            oled->queueX0[i] = x0 + n;
+        }
+        else {
+            oled->queueX0[i] = OLED_WIDTH - 1;          // page is no longer queued
+            oled->queueX1[i] = 0;
+            oled->queuePage = (i + 1) % (OLED_HEIGHT/8);
+        }
+        oled->txDone = 1;
+        return 1;
+    }
+
+    if (oled->txDone){                                  // queue has just been emptied
+        oled->txDone = 0;
+        if (oled->OnComplete != NULL) oled->OnComplete(oled);
+    }
+    return 0;
+}
+
+//========================================
+// oled_SetBackBuffer()
+// this function turns on double buffering.
+// Drawing functions then modify a back buffer
+// while the front buffer is sent to the display,
+// and oled_Present() swaps the two. Use 
+// oled_Present() in place of oled_Flush().
+// Turning it on or off carries on from the
+// frame on the display, except on pages drawn
+// on since the last oled_Present(): these 
+// keep the drawing and are sent by the next
+// flush
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     back - pointer to an array of OLED_GRAM_SIZE
+//            bytes used as the second buffer, or
+//            NULL to turn double buffering off
+//========================================
+void oled_SetBackBuffer(oled_t * oled, uint8 * back)
+{
+    while (oled_IsBusy(oled));                          // the front buffer may be in use by a transfer
+    for (int i=0; i<OLED_HEIGHT/8; i++){                // GRAM lacks the changes of the last presented frame (see oled_Present())
+        int x0 = oled->prevX0[i], x1 = oled->prevX1[i];
+        if (x1 < x0) continue;
+        if (oled->dirtyX1[i] < oled->dirtyX0[i]){       // page not drawn on since: take those columns from the front buffer, which the display shows
+            for (int j=x0; j<=x1; j++) oled->GRAM[i*OLED_WIDTH + j] = oled->txGRAM[i*OLED_WIDTH + j];
+        }
+        else {                                          // page drawn on since: keep GRAM and resend those columns as well
+            if (x0 < oled->dirtyX0[i]) oled->dirtyX0[i] = x0;
+            if (x1 > oled->dirtyX1[i]) oled->dirtyX1[i] = x1;
+        }
+        oled->prevX0[i] = OLED_WIDTH - 1;               // both buffers will hold the same frame
+        oled->prevX1[i] = 0;
+    }
+    if (back == NULL){                                  // single buffered: keep drawing into the built-in buffer
+        if (oled->GRAM != oled->buffer){
+            for (int i=0; i<OLED_GRAM_SIZE; i++) oled->buffer[i] = oled->GRAM[i];
+        }
+        oled->GRAM = oled->buffer;
+        oled->txGRAM = oled->buffer;
+        if (oled->updateMode == OLED_UPDATE_IMMEDIATE) oled_Flush(oled);    // drawing only sends what it changes from now on
+        return;
+    }
+    for (int i=0; i<OLED_GRAM_SIZE; i++){               // carry on drawing from the current contents, in both buffers
+        back[i] = oled->GRAM[i];
+        oled->buffer[i] = oled->GRAM[i];
+    }
+    oled->txGRAM = oled->buffer;
+    oled->GRAM = back;
+}
+
+//========================================
+// oled_Present()
+// this function shows the frame drawn since the
+// last call: the back and front buffers are swapped
+// (no copying) and the changes are sent from the
+// new front buffer. With background transfers
+// (see oled_SetTransport()) the function returns as soon
+// as the transfer is queued, and only waits if the
+// previous frame is still being sent. After the swap
+// the back buffer holds the frame before the one
+// presented, so frames should be redrawn in full.
+// Without a back buffer this is the same as oled_Flush()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_Present(oled_t * oled)
+{
+    if (oled->GRAM == oled->txGRAM){                    // single buffered
+        oled_Flush(oled);
+        return;
+    }
+    while (oled_IsBusy(oled));                          // wait for the previous frame to leave the front buffer
 
-    oled->SendStart(slaveAddr, 0x00);               // generate Start condition and send slave address with R/W# bit = 0 (write mode)
-    for (int i=0; i<(int)sizeof(initCmds); i++){  
-        oled->WriteByte(initCmds[i]);               // send initialization commands/parameters
-    }   
-    oled->SendStop();                               // generate Stop condition
+    uint8 * front = oled->GRAM;                         // swap buffers
+    oled->GRAM = oled->txGRAM;
+    oled->txGRAM = front;
+
+    uint8 x0, x1;
+    for (int i=0; i<OLED_HEIGHT/8; i++){                // the new front buffer differs from the display by the changes of this frame and the previous one
+        x0 = oled->dirtyX0[i];
+        x1 = oled->dirtyX1[i];
+        if (oled->prevX1[i] >= oled->prevX0[i]){
+            if (oled->dirtyX1[i] < oled->dirtyX0[i]){
+                oled->dirtyX0[i] = oled->prevX0[i];
+                oled->dirtyX1[i] = oled->prevX1[i];
+            }
+            else {
+                if (oled->prevX0[i] < oled->dirtyX0[i]) oled->dirtyX0[i] = oled->prevX0[i];
+                if (oled->prevX1[i] > oled->dirtyX1[i]) oled->dirtyX1[i] = oled->prevX1[i];
+            }
+        }
+        oled->prevX0[i] = x0;                           // changes of this frame still have to be made to the new back buffer
+        oled->prevX1[i] = x1;
+    }
+    oled_Flush(oled);                                   // send (or queue) the changes from the front buffer
 }
 
 //========================================
@@ -154,9 +626,10 @@ uint8 oled_GetPenSize(oled_t * oled)
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     font - pointer to a font_t structure
+//     font - pointer to a font_t structure (e.g. &font,
+//            &fontProp)
 //========================================
-void oled_SetFont(oled_t * oled, font_t * font)
+void oled_SetFont(oled_t * oled, const font_t * font)
 {
     oled->font = font;
 }
@@ -221,17 +694,131 @@ uint8 oled_GetTextMode(oled_t * oled)
     return oled->textMode;
 }
 
+//========================================
+// oled_SetRasterOp()
+// this function sets how drawing functions
+// (shapes, bitmaps and text) combine the 
+// pixels they draw with GRAM. With OLED_ROP_XOR,
+// drawing something a second time erases it,
+// e.g. a cursor or a rubber-band rectangle, 
+// without redrawing what was under it. Pixels
+// are combined as if white were 1 and black 0,
+// so OR, AND-NOT and XOR only change pixels 
+// drawn in white. oled_Clear(), oled_ClearRect()
+// and oled_InvertRect() are not affected. Each
+// pixel of a shape is drawn once, except where
+// the corners of oled_DrawRoundedRect() meet
+// its sides and, with a pen size above 0, 
+// where the edges of oled_DrawPolygon() meet
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     rop - OLED_ROP_COPY, OLED_ROP_OR, 
+//           OLED_ROP_AND_NOT or OLED_ROP_XOR
+//========================================
+void oled_SetRasterOp(oled_t * oled, uint8 rop)
+{
+    if ((rop == OLED_ROP_COPY) ||
+        (rop == OLED_ROP_OR) ||
+        (rop == OLED_ROP_AND_NOT) ||
+        (rop == OLED_ROP_XOR)) oled->rop = rop;
+}
+
+//========================================
+// oled_GetRasterOp()
+// this function returns the raster operation
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+uint8 oled_GetRasterOp(oled_t * oled)
+{
+    return oled->rop;
+}
+
+//========================================
+// oled_PushClip()
+// this function saves the current viewport 
+// and makes the rectangle defined by its upper
+// left corner (x0, y0) and lower right corner
+// (x1, y1) the new one: drawing functions only
+// draw inside it (and inside the viewports it
+// is pushed in), and their coordinates are 
+// relative to (x0, y0). Widgets can then redraw
+// themselves without drawing over their 
+// neighbours. oled_Clear() clears the viewport.
+// Shapes entirely outside it are rejected 
+// before they are drawn. oled_FlushRect() 
+// still takes display coordinates
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//
+// Returns:
+//     1 if the viewport was pushed, 0 if 
+//     OLED_CLIP_DEPTH viewports are already 
+//     saved (nothing is changed)
+//========================================
+uint8 oled_PushClip(oled_t * oled, int x0, int y0, int x1, int y1)
+{
+    if (oled->clipDepth == OLED_CLIP_DEPTH) return 0;  // no room to save the current viewport
+    oled_clip_t * clip = &oled->clip;
+    oled->clipStack[oled->clipDepth++] = *clip;
+
+    x0 += clip->ox;                                     // display coordinates
+    y0 += clip->oy;
+    x1 += clip->ox;
+    y1 += clip->oy;
+    clip->ox = x0;                                      // new origin
+    clip->oy = y0;
+    if (x0 > clip->x0) clip->x0 = x0;                   // the part of the rectangle inside the current viewport
+    if (y0 > clip->y0) clip->y0 = y0;
+    if (x1 < clip->x1) clip->x1 = x1;
+    if (y1 < clip->y1) clip->y1 = y1;
+    return 1;
+}
+
+//========================================
+// oled_PopClip()
+// this function restores the viewport saved
+// by the last successful oled_PushClip(). 
+// Without one the whole display is the 
+// viewport
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_PopClip(oled_t * oled)
+{
+    if (oled->clipDepth > 0){
+        oled->clip = oled->clipStack[--oled->clipDepth];
+        return;
+    }
+    oled->clip.x0 = 0;                                  // the whole display
+    oled->clip.y0 = 0;
+    oled->clip.x1 = OLED_WIDTH - 1;
+    oled->clip.y1 = OLED_HEIGHT - 1;
+    oled->clip.ox = 0;
+    oled->clip.oy = 0;
+}
+
 //========================================
 // oled_Clear()
 // this functions clears the screan (fills it
-// with the background color)
+// with the background color), or only the
+// viewport (see oled_PushClip())
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
 //========================================
 void oled_Clear(oled_t * oled)
 {
-    WriteGRAM(oled, 0, 0, OLED_WIDTH-1, OLED_HEIGHT-1, oled->bkColor);      // fill screen with background color         
+    oled_clip_t * clip = &oled->clip;
+    WriteGRAM(oled, clip->x0 - clip->ox, clip->y0 - clip->oy, clip->x1 - clip->ox, clip->y1 - clip->oy, oled->bkColor);   // fill screen (viewport) with background color
 }
 
 //========================================
@@ -253,6 +840,25 @@ void oled_ClearRect(oled_t * oled, int x0, int y0, int x1, int y1)
     WriteGRAM(oled, x0, y0, x1, y1, oled->bkColor);     // clear rectangle   
 }
 
+//========================================
+// oled_InvertRect()
+// this functions inverts the pixels of a 
+// rectangle defined by its upper left corner
+// (x0, y0) and lower right corner (x1, y1),
+// e.g. to highlight a menu item
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//========================================
+void oled_InvertRect(oled_t * oled, int x0, int y0, int x1, int y1)
+{
+    WriteGRAM(oled, x0, y0, x1, y1, OLED_INVERT);       // invert rectangle
+}
+
 //========================================
 // oled_DrawPixel()
 // this function fills the pixel located at (x, y)
@@ -265,7 +871,7 @@ void oled_ClearRect(oled_t * oled, int x0, int y0, int x1, int y1)
 //========================================
 void oled_DrawPixel(oled_t * oled, int x, int y)
 {
-    WriteGRAM(oled, x, y, x, y, oled->color);       // draw pixel
+    WriteGRAM(oled, x, y, x, y, RasterOp(oled, oled->color));   // draw pixel
 } 
 
 //========================================
@@ -294,6 +900,13 @@ void oled_DrawLine(oled_t * oled, int x0, int y0, int x1, int y1)
         Swap(&x0, &x1);                         // swap x coordinates
         Swap(&y0, &y1);                         // swap y coordinates
     }
+    x0 += oled->clip.ox;                        // display coordinates
+    y0 += oled->clip.oy;
+    x1 += oled->clip.ox;
+    y1 += oled->clip.oy;
+    int p = oled->penSize;                      // reject lines outside the clip rectangle
+    if ((x1 + p < oled->clip.x0) || (x0 - p > oled->clip.x1)) return;
+    if ((((y0 < y1) ? y1 : y0) + p < oled->clip.y0) || (((y0 < y1) ? y0 : y1) - p > oled->clip.y1)) return;
                                                 // Bresenham's line algorith assumes the slope of the line is between 0 and 1. If the line does not satisfy this condition,
                                                 // swap coordinates to put the line in this form. rot keeps track of which rotation was made
     uint8 rot = 1;                              // 0 <= slope <= 1
@@ -333,7 +946,7 @@ void oled_DrawLine(oled_t * oled, int x0, int y0, int x1, int y1)
 //========================================
 void oled_FillRect(oled_t * oled, int x0, int y0, int x1, int y1)
 {
-    WriteGRAM(oled, x0, y0, x1, y1, oled->color);       // fill rectangle
+    WriteGRAM(oled, x0, y0, x1, y1, RasterOp(oled, oled->color));   // fill rectangle
 }
 
 //========================================
@@ -341,7 +954,10 @@ void oled_FillRect(oled_t * oled, int x0, int y0, int x1, int y1)
 // this functions fills a rectangle defined by
 // its upper left corner (x0, y0) and lower right
 // corner (x1, y1). The corners of the rectangle 
-// are rounded with radius r
+// are rounded with radius r. The rectangle is
+// filled in one pass, one span per row: a
+// filled circle of radius r stretched to the
+// size of the rectangle
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
@@ -356,13 +972,11 @@ void oled_FillRect(oled_t * oled, int x0, int y0, int x1, int y1)
 void oled_FillRoundedRect(oled_t * oled, int x0, int y0, int x1, int y1, int r)
 {
     if ((x1 - x0 < 2*r) || (y1 - y0 < 2*r)) return;     // raidus must be less than or equal to 1/2 the smallest side length
-    oled_FillRect(oled, x0+r, y0, x1-r, y1);            // fill in rectangle
-    oled_FillRect(oled, x0, y0+r, x0+r, y1-r);
-    oled_FillRect(oled, x1-r, y0+r, x1, y1-r);
-    oled_DrawPie(oled, x1-r, y0+r, r, 6, 8);            // fill in corners
-    oled_DrawPie(oled, x0+r, y0+r, r, 4, 6);
-    oled_DrawPie(oled, x0+r, y1-r, r, 2, 4);
-    oled_DrawPie(oled, x1-r, y1-r, r, 0, 2);
+    if (r <= 0){                                        // no corners to round
+        oled_FillRect(oled, x0, y0, x1, y1);
+        return;
+    }
+    RoundedCircleAlgorithm(oled, x0+r, y0+r, x1-r, y1-r, 0, r, 0xFF, NULL);    // the corners' circle, stretched between their centers
 }
 
 //========================================
@@ -381,10 +995,16 @@ void oled_FillRoundedRect(oled_t * oled, int x0, int y0, int x1, int y1, int r)
 void oled_DrawRect(oled_t * oled, int x0, int y0, int x1, int y1)
 {
     if ((x1 < x0) || (y1 < y0)) return;     // check for bad parameters
-    DrawHLine(oled, y0, x0, x1);            // draw boundries of rectange
-    DrawHLine(oled, y1, x0, x1);
-    DrawVLine(oled, x0, y0, y1);
-    DrawVLine(oled, x1, y0, y1);
+    int p = oled->penSize;
+    uint8 op = RasterOp(oled, oled->color);
+    if ((x1 - x0 <= 2*p) || (y1 - y0 <= 2*p)){      // sides meet: the rectangle is solid
+        WriteGRAM(oled, x0-p, y0-p, x1+p, y1+p, op);
+        return;
+    }
+    WriteGRAM(oled, x0-p, y0-p, x1+p, y0+p, op);    // draw boundries of rectange, each pixel once
+    WriteGRAM(oled, x0-p, y1-p, x1+p, y1+p, op);
+    WriteGRAM(oled, x0-p, y0+p+1, x0+p, y1-p-1, op);
+    WriteGRAM(oled, x1-p, y0+p+1, x1+p, y1-p-1, op);
 }
 
 //========================================
@@ -430,7 +1050,7 @@ void oled_DrawRoundedRect(oled_t * oled, int x0, int y0, int x1, int y1, int r)
 //========================================
 void oled_DrawCircle(oled_t * oled, int xc, int yc, int r)
 {
-    BresenhamCircleAlgorithm(oled, xc, yc, r-oled->penSize, r+oled->penSize, 0xFF);     // draw circle using Bresenham's Circle Algorithm
+    BresenhamCircleAlgorithm(oled, xc, yc, r-oled->penSize, r+oled->penSize, 0xFF, NULL);     // draw circle using Bresenham's Circle Algorithm
 }
 
 //========================================
@@ -453,7 +1073,7 @@ void oled_DrawArc(oled_t * oled, int xc, int yc, int r, int a0, int a1)
     if ((a0 < 0) || (a1 > 8)) return;                   // make sure a0 and a1 are between 0 and 8 (inclusive)
 
     uint8 octants = (0xFF >> (8-a1)) & (0xFF << a0);    
-    BresenhamCircleAlgorithm(oled, xc, yc, r-oled->penSize, r+oled->penSize, octants);  // draw arc using Bresenham's Circle Algorithm  
+    BresenhamCircleAlgorithm(oled, xc, yc, r-oled->penSize, r+oled->penSize, octants, NULL);  // draw arc using Bresenham's Circle Algorithm  
 }
 
 //========================================
@@ -469,7 +1089,7 @@ void oled_DrawArc(oled_t * oled, int xc, int yc, int r, int a0, int a1)
 //========================================
 void oled_FillCircle(oled_t * oled, int xc, int yc, int r)
 {
-    BresenhamCircleAlgorithm(oled, xc, yc, 0, r, 0xFF);     // fill circle using Bresenham's Circle Algorithm (with inner radius set to 0)
+    BresenhamCircleAlgorithm(oled, xc, yc, 0, r, 0xFF, NULL);     // fill circle using Bresenham's Circle Algorithm (with inner radius set to 0)
 }
 
 //========================================
@@ -486,7 +1106,7 @@ void oled_FillCircle(oled_t * oled, int xc, int yc, int r)
 //========================================
 void oled_DrawPoint(oled_t * oled, int xc, int yc)
 {
-    BresenhamCircleAlgorithm(oled, xc, yc, 0, oled->penSize, 0xFF);     // draw point using Bresenham's Circle Algorithm (same as oled_FillCircle() but with r = oled->penSize)
+    BresenhamCircleAlgorithm(oled, xc, yc, 0, oled->penSize, 0xFF, NULL);     // draw point using Bresenham's Circle Algorithm (same as oled_FillCircle() but with r = oled->penSize)
 }
 
 //========================================
@@ -509,90 +1129,420 @@ void oled_DrawPie(oled_t * oled, int xc, int yc, int r, int a0, int a1)
     if ((a0 < 0) || (a1 > 8)) return;                       // make sure a0 and a1 are between 0 and 8 (inclusive)
 
     uint8 octants = (0xFF >> (8-a1)) & (0xFF << a0);    
-    BresenhamCircleAlgorithm(oled, xc, yc, 0, r, octants);  // draw circular sector ("pie") using Bresenham's Circle Algorithm
+    BresenhamCircleAlgorithm(oled, xc, yc, 0, r, octants, NULL);  // draw circular sector ("pie") using Bresenham's Circle Algorithm
 }
 
-//======================================
-// oled_DispBitmap()
-// this function displays the given bitmap
-// with its top left corner at (x0, y0). 
-// Option for how the bitmap is displayed 
-// can be found in the user manual and can
-// be set using oled_SetBmMode() 
+//========================================
+// oled_DrawArcAngle()
+// this function draws an arc of radius r
+// centered at (xc, yc) from angle a0 to angle
+// a1 (any angle, see OLED_DEGREES()). Angles 
+// increase clockwise from the right, as the
+// octants of oled_DrawArc() do (16384 = down);
+// the arc runs from a0 in that direction,
+// through 0 if a1 < a0. a0 == a1 draws the
+// whole circle
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     x0 - x-coordinate for upper left corner of bitmap
-//     y0 - y-coordinate for upper left corner of bitmap
-//     bitmap - pointer to an array containing pixel values 
-//              (.xbm format)
-//     width - width of the bitmap (in pixels)
-//     height - height of the bitmap (in pixels)
-//======================================
-void oled_DispBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16 width, uint16 height){
-    uint8 color;
-    for (int i=0; i<height; i++){
-        for (int j=0; j<width; j++){
-            color = (bitmap[i*((width-1)/8 + 1) + j/8] >> (j%8)) & 0x01;                // get color of pixel
-            
-            if (oled->bmMode == OLED_BM_NORMAL){                                        // OLED_BM_NORMAL: bitmap displayed "as is"
-                WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, color);
-            }
-            else if (oled->bmMode == OLED_BM_INV){                                      // OLED_BM_INV: bitmap displayed with pixels inverted
-                WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, ~(color | 0xfe));
-            }
-            if (oled->bmMode == OLED_BM_WHITE_TRAN){                                    // OLED_BM_WHITE_TRAN: white pixels are displayed in the forground color, black pixels are transparent
-                if (color == 1) WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, oled->color);   
-            }
-            else if (oled->bmMode == OLED_BM_BLACK_TRAN){                               // OLED_BM_BLACK_TRAN: black pixels are displayed in the forground color, white pixels are transparent
-                if (color == 0) WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, oled->color);   
-            }
-            else if (oled->bmMode == OLED_BM_WHITE_FILL){                               // OLED_BM_WHITE_FILL: white pixels are displayed in the forground color, black pixels are displayed in the background color
-                if (color == 1) WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, oled->color);
-                else WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, oled->bkColor);
-            }
-            else if (oled->bmMode ==  OLED_BM_BLACK_FILL){                              // OLED_BM_BLACK_FILL: black pixels are displayed in the forground color, white pixels are displayed in the forground color
-                if (color == 0) WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, oled->color); 
-                else WriteGRAM(oled, x0+j, y0+i, x0+j, y0+i, oled->bkColor);
-            }
-        }
-    }
+//     xc - x-coordinate of the center of the arc (center of circle)
+//     yc - y-coordinate of the center of the arc (center of circle)
+//     r - radius of arc
+//     a0 - start angle (65536 = one turn)
+//     a1 - end angle (65536 = one turn)
+//========================================
+void oled_DrawArcAngle(oled_t * oled, int xc, int yc, int r, uint16 a0, uint16 a1)
+{
+    sector_t sector;
+    MakeSector(&sector, a0, a1);
+    BresenhamCircleAlgorithm(oled, xc, yc, r-oled->penSize, r+oled->penSize, 0xFF, &sector);   // the ring, limited to the sector
 }
 
 //========================================
-// oled_DispChar()
-// this function displays the character c
-// with its top left corner at (x0, y0). The
-// character is displayed in the font specified
-// by oled.font. Option for how the character is 
-// displayed can be found in the user manual 
-// and can be set using oled_SetTextMode()
+// oled_DrawPieAngle()
+// this function draws a circular sector of
+// radius r centered at (xc, yc) from angle a0
+// to angle a1 (see oled_DrawArcAngle())
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     x0 - x-coordinate for upper left corner of 
-//          the character
-//     y0 - y-coordinate for upper left corner of 
-//          the character
-//     c - character to be displayed
+//     xc - x-coordinate of the center of the sector (center of circle)
+//     yc - y-coordinate of the center of the sector (center of circle)
+//     r - radius of circular sector
+//     a0 - start angle (65536 = one turn)
+//     a1 - end angle (65536 = one turn)
 //========================================
-void oled_DispChar(oled_t * oled, int x0, int y0, const char c){
-    uint8 bmMode = oled_GetBmMode(oled);        // store current bitmap mode
-    oled_SetBmMode(oled, oled->textMode);       // set bmMode to text mode
-    int i = c - 32;
-    if ((i < 0) || (i > 94)) return;            // character out of range
-    oled_DispBitmap(oled, x0, y0, oled->font->characters[i], oled->font->width, oled->font->height);    // display char
-    oled_SetBmMode(oled, bmMode);               // restore bitmap mode
+void oled_DrawPieAngle(oled_t * oled, int xc, int yc, int r, uint16 a0, uint16 a1)
+{
+    sector_t sector;
+    MakeSector(&sector, a0, a1);
+    BresenhamCircleAlgorithm(oled, xc, yc, 0, r, 0xFF, &sector);   // the disc, limited to the sector
 }
 
 //========================================
-// oled_DispString
-// this function displays the string s
-// with the top left corner of the first character
-// at (x0, y0). The characters are displayed in the 
-// font specified by oled.font. Option for how the 
+// oled_DrawEllipse()
+// this function draws an ellipse centered at
+// (xc, yc) with horizontal radius rx and 
+// vertical radius ry, using the midpoint 
+// ellipse algorithm. The pen size widens the
+// outline as it does for oled_DrawCircle()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the ellipse
+//     yc - y-coordinate of the center of the ellipse
+//     rx - horizontal radius (up to OLED_ELLIPSE_RADIUS
+//          with the pen)
+//     ry - vertical radius (up to OLED_ELLIPSE_RADIUS
+//          with the pen)
+//========================================
+void oled_DrawEllipse(oled_t * oled, int xc, int yc, int rx, int ry)
+{
+    MidpointEllipseAlgorithm(oled, xc, yc, rx-oled->penSize, ry-oled->penSize, rx+oled->penSize, ry+oled->penSize);   // the ring between the inner and outer ellipse
+}
+
+//========================================
+// oled_FillEllipse()
+// this function fills an ellipse centered at
+// (xc, yc) with horizontal radius rx and
+// vertical radius ry (see oled_DrawEllipse())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the ellipse
+//     yc - y-coordinate of the center of the ellipse
+//     rx - horizontal radius (up to OLED_ELLIPSE_RADIUS)
+//     ry - vertical radius (up to OLED_ELLIPSE_RADIUS)
+//========================================
+void oled_FillEllipse(oled_t * oled, int xc, int yc, int rx, int ry)
+{
+    MidpointEllipseAlgorithm(oled, xc, yc, -1, -1, rx, ry);    // no inner ellipse
+}
+
+//========================================
+// oled_FillPolygon()
+// this function fills the polygon with the
+// n corners given, in order, by points. The
+// polygon may be concave or cross itself:
+// the parts inside an odd number of its
+// edges are filled, together with the edges
+// themselves. Each row is filled as a few
+// spans, each with a single GRAM operation
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     points - pointer to an array of n (x, y)
+//              pairs (2*n values)
+//     n - number of corners (1 to 
+//         OLED_POLYGON_POINTS)
+//========================================
+void oled_FillPolygon(oled_t * oled, const int16 * points, uint8 n)
+{
+    ScanPolygon(oled, points, n, 1);
+}
+
+//========================================
+// oled_DrawPolygon()
+// this function draws the outline of the 
+// polygon with the n corners given, in order,
+// by points. With pen size 0 (and up to 
+// OLED_POLYGON_POINTS corners) the outline is
+// scanned row by row like oled_FillPolygon(),
+// so each pixel is drawn once, corners and
+// crossings included. Otherwise its edges are
+// drawn as lines (see oled_DrawLine()) with
+// the current pen size
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     points - pointer to an array of n (x, y)
+//              pairs (2*n values)
+//     n - number of corners
+//========================================
+void oled_DrawPolygon(oled_t * oled, const int16 * points, uint8 n)
+{
+    if (n == 0) return;
+    if ((oled->penSize == 0) && (n <= OLED_POLYGON_POINTS)){    // one path: each pixel once
+        ScanPolygon(oled, points, n, 0);
+        return;
+    }
+    if (n <= 2){                                        // a point or a single line, not drawn there and back
+        oled_DrawLine(oled, points[0], points[1], points[2*n - 2], points[2*n - 1]);
+        return;
+    }
+    for (int i=0; i<n; i++){
+        int j = (i + 1 < n) ? i + 1 : 0;                // the last edge closes the polygon
+        oled_DrawLine(oled, points[2*i], points[2*i + 1], points[2*j], points[2*j + 1]);
+    }
+}
+
+//========================================
+// oled_FillTriangle()
+// this function fills the triangle with 
+// corners (x0, y0), (x1, y1) and (x2, y2)
+// (see oled_FillPolygon())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate of the first corner
+//     y0 - y-coordinate of the first corner
+//     x1 - x-coordinate of the second corner
+//     y1 - y-coordinate of the second corner
+//     x2 - x-coordinate of the third corner
+//     y2 - y-coordinate of the third corner
+//========================================
+void oled_FillTriangle(oled_t * oled, int x0, int y0, int x1, int y1, int x2, int y2)
+{
+    int16 points[6] = {x0, y0, x1, y1, x2, y2};
+    oled_FillPolygon(oled, points, 3);
+}
+
+//========================================
+// oled_DrawTriangle()
+// this function draws the outline of the 
+// triangle with corners (x0, y0), (x1, y1) and
+// (x2, y2) (see oled_DrawPolygon())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate of the first corner
+//     y0 - y-coordinate of the first corner
+//     x1 - x-coordinate of the second corner
+//     y1 - y-coordinate of the second corner
+//     x2 - x-coordinate of the third corner
+//     y2 - y-coordinate of the third corner
+//========================================
+void oled_DrawTriangle(oled_t * oled, int x0, int y0, int x1, int y1, int x2, int y2)
+{
+    int16 points[6] = {x0, y0, x1, y1, x2, y2};
+    oled_DrawPolygon(oled, points, 3);
+}
+
+//========================================
+// oled_SetSpanCache()
+// this function gives the oled an array of
+// entries in which to keep the spans of the
+// circles, arcs and pies it draws (see
+// oled_DrawCircle()), so that shapes redrawn
+// every frame (e.g. gauges or indicator dots)
+// skip computing them. Only shapes with an
+// outer radius up to OLED_SPAN_CACHE_RADIUS
+// are cached; the least recently used entry
+// is replaced
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     cache - pointer to an array of entries,
+//             or NULL to stop using it
+//     size - number of entries
+//========================================
+void oled_SetSpanCache(oled_t * oled, oled_span_cache_t * cache, uint8 size)
+{
+    oled->spanCache = cache;
+    oled->spanCacheSize = (cache == NULL) ? 0 : size;
+    for (int i=0; i<oled->spanCacheSize; i++){
+        cache[i].rOut = 0;                              // empty
+        cache[i].age = 255;                             // replaced first
+    }
+}
+
+//======================================
+// oled_DispBitmap()
+// this function displays the given bitmap
+// with its top left corner at (x0, y0). 
+// Option for how the bitmap is displayed 
+// can be found in the user manual and can
+// be set using oled_SetBmMode(). The bitmap
+// is converted to GRAM format 8x8 pixels at
+// a time and sent to the display as a single
+// block
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate for upper left corner of bitmap
+//     y0 - y-coordinate for upper left corner of bitmap
+//     bitmap - pointer to an array containing pixel values 
+//              (.xbm format)
+//     width - width of the bitmap (in pixels)
+//     height - height of the bitmap (in pixels)
+//======================================
+void oled_DispBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16 width, uint16 height){
+    int bx0 = 0, by0 = 0, bx1 = width - 1, by1 = height - 1;   // part of the bitmap inside the clip rectangle
+    const oled_clip_t * clip = &oled->clip;
+    x0 += clip->ox;                                     // display coordinates
+    y0 += clip->oy;
+    if (x0 < clip->x0) bx0 = clip->x0 - x0;
+    if (y0 < clip->y0) by0 = clip->y0 - y0;
+    if (x0 + bx1 > clip->x1) bx1 = clip->x1 - x0;
+    if (y0 + by1 > clip->y1) by1 = clip->y1 - y0;
+    if ((bx1 < bx0) || (by1 < by0)) return;
+
+    int stride = (width - 1)/8 + 1;                     // bytes per row of the bitmap
+    int shift = y0 & 0x07;                              // row of its page that the top of each 8 row band of the bitmap lands on
+    uint8 cols[8];
+    int block[4] = {OLED_WIDTH, OLED_HEIGHT/8, -1, -1};    // block of GRAM actually drawn in (transparent pixels are not): left column, top page, right column, bottom page
+    for (int t=by0/8; t<=by1/8; t++){                   // iterate over 8 row bands of the bitmap
+        int count = height - 8*t;                       // rows in the band
+        if (count > 8) count = 8;
+        uint8 mask = 0xFF;                              // rows of the band that are on the display
+        if (8*t < by0) mask = mask << (by0 - 8*t);
+        if (8*t + 7 > by1) mask = mask & (0xFF >> (8*t + 7 - by1));
+        int p = (y0 + 8*t - shift)/8;                   // page the top of the band lands on (-1 if the band starts above the display)
+        for (int b=bx0/8; b<=bx1/8; b++){               // iterate over 8x8 tiles of the band
+            TransposeTile(&bitmap[8*t*stride + b], stride, count, cols);   // rows of pixels to columns of pixels (page format)
+            for (int k=0; k<8; k++){
+                int x = 8*b + k;
+                if ((x < bx0) || (x > bx1)) continue;
+                BlitColumn(oled, x0 + x, p, shift, cols[k], mask, block);
+            }
+        }
+    }
+    if (block[2] >= block[0]) UpdateDisplay(oled, block[0], block[1], block[2], block[3]);  // one block for the whole bitmap
+}
+
+//======================================
+// oled_DispPageBitmap()
+// this function displays the given bitmap
+// with its top left corner at (x0, y0), like
+// oled_DispBitmap(), but takes the bitmap in
+// GRAM format (see host/xbm2page.c): pages of
+// 8 rows, each page stored as one byte per
+// column with bit 0 the top pixel. When y0 is
+// a multiple of 8 and the bitmap mode is 
+// OLED_BM_NORMAL, whole pages are copied 
+// straight into GRAM
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate for upper left corner of bitmap
+//     y0 - y-coordinate for upper left corner of bitmap
+//     bitmap - pointer to an array of (height+7)/8 pages
+//              of width bytes each
+//     width - width of the bitmap (in pixels)
+//     height - height of the bitmap (in pixels)
+//======================================
+void oled_DispPageBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16 width, uint16 height){
+    int bx0 = 0, by0 = 0, bx1 = width - 1, by1 = height - 1;   // part of the bitmap inside the clip rectangle
+    const oled_clip_t * clip = &oled->clip;
+    x0 += clip->ox;                                     // display coordinates
+    y0 += clip->oy;
+    if (x0 < clip->x0) bx0 = clip->x0 - x0;
+    if (y0 < clip->y0) by0 = clip->y0 - y0;
+    if (x0 + bx1 > clip->x1) bx1 = clip->x1 - x0;
+    if (y0 + by1 > clip->y1) by1 = clip->y1 - y0;
+    if ((bx1 < bx0) || (by1 < by0)) return;
+
+    int shift = y0 & 0x07;                              // row of its page that the top of each page of the bitmap lands on
+    int block[4] = {OLED_WIDTH, OLED_HEIGHT/8, -1, -1}; // block of GRAM actually drawn in
+    for (int t=by0/8; t<=by1/8; t++){                   // iterate over pages of the bitmap
+        uint8 mask = 0xFF;                              // rows of the page that are on the display
+        if (8*t < by0) mask = mask << (by0 - 8*t);
+        if (8*t + 7 > by1) mask = mask & (0xFF >> (8*t + 7 - by1));
+        int p = (y0 + 8*t - shift)/8;                   // page of GRAM the top of the page lands on
+        const uint8 * cols = &bitmap[t*width];
+        if ((shift == 0) && (mask == 0xFF) && (oled->bmMode == OLED_BM_NORMAL) && (oled->rop == OLED_ROP_COPY)){    // the page replaces part of a page of GRAM
+            memcpy(&oled->GRAM[p*OLED_WIDTH + x0 + bx0], &cols[bx0], bx1 - bx0 + 1);
+            GrowBlock(block, x0 + bx0, p);
+            GrowBlock(block, x0 + bx1, p);
+            continue;
+        }
+        for (int x=bx0; x<=bx1; x++){
+            BlitColumn(oled, x0 + x, p, shift, cols[x], mask, block);
+        }
+    }
+    if (block[2] >= block[0]) UpdateDisplay(oled, block[0], block[1], block[2], block[3]);  // one block for the whole bitmap
+}
+
+//========================================
+// oled_DispRLEBitmap()
+// this function displays the given bitmap
+// with its top left corner at (x0, y0), like
+// oled_DispPageBitmap(), but takes the bitmap
+// compressed (see host/xbm2page.c -r). It is
+// expanded a byte at a time straight into
+// GRAM, without a buffer for the whole bitmap.
+// The compressed bitmap is a series of packets,
+// each one a control byte c followed by:
+//     c < 0x80: c+1 bytes of the bitmap
+//     c >= 0x80: one byte, repeated (c & 0x7F)+2
+//                times
+// which expand to the (height+7)/8 pages of
+// width bytes of oled_DispPageBitmap()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate for upper left corner of bitmap
+//     y0 - y-coordinate for upper left corner of bitmap
+//     bitmap - pointer to the compressed bitmap
+//     width - width of the bitmap (in pixels)
+//     height - height of the bitmap (in pixels)
+//========================================
+void oled_DispRLEBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16 width, uint16 height){
+    int bx0 = 0, by0 = 0, bx1 = width - 1, by1 = height - 1;   // part of the bitmap inside the clip rectangle
+    const oled_clip_t * clip = &oled->clip;
+    x0 += clip->ox;                                     // display coordinates
+    y0 += clip->oy;
+    if (x0 < clip->x0) bx0 = clip->x0 - x0;
+    if (y0 < clip->y0) by0 = clip->y0 - y0;
+    if (x0 + bx1 > clip->x1) bx1 = clip->x1 - x0;
+    if (y0 + by1 > clip->y1) by1 = clip->y1 - y0;
+    if ((bx1 < bx0) || (by1 < by0)) return;
+
+    rle_t rle = {bitmap, 0, 0};
+    int shift = y0 & 0x07;                              // row of its page that the top of each page of the bitmap lands on
+    int block[4] = {OLED_WIDTH, OLED_HEIGHT/8, -1, -1}; // block of GRAM actually drawn in
+    RLESkip(&rle, (by0/8)*width);                       // pages above the display
+    for (int t=by0/8; t<=by1/8; t++){                   // iterate over pages of the bitmap
+        uint8 mask = 0xFF;                              // rows of the page that are on the display
+        if (8*t < by0) mask = mask << (by0 - 8*t);
+        if (8*t + 7 > by1) mask = mask & (0xFF >> (8*t + 7 - by1));
+        int p = (y0 + 8*t - shift)/8;                   // page of GRAM the top of the page lands on
+        RLESkip(&rle, bx0);                             // columns left of the display
+        for (int x=bx0; x<=bx1; x++){
+            BlitColumn(oled, x0 + x, p, shift, RLENext(&rle), mask, block);
+        }
+        if (t < by1/8) RLESkip(&rle, width - 1 - bx1);  // columns right of the display
+    }
+    if (block[2] >= block[0]) UpdateDisplay(oled, block[0], block[1], block[2], block[3]);  // one block for the whole bitmap
+}
+
+//========================================
+// oled_DispChar()
+// this function displays the character c
+// with its top left corner at (x0, y0). The
+// character is displayed in the font specified
+// by oled.font. Option for how the character is 
+// displayed can be found in the user manual 
+// and can be set using oled_SetTextMode().
+// The character is copied from the font into
+// GRAM a page at a time, and is as wide as the
+// font says (fonts may be proportional)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate for upper left corner of 
+//          the character
+//     y0 - y-coordinate for upper left corner of 
+//          the character
+//     c - character to be displayed
+//========================================
+void oled_DispChar(oled_t * oled, int x0, int y0, const char c){
+    if (((uint8)c < oled->font->first) || ((uint8)c > oled->font->last)) return;   // character out of range
+    DispLine(oled, x0, y0, &c, 1);              // display char
+}
+
+//========================================
+// oled_DispString
+// this function displays the string s
+// with the top left corner of the first character
+// at (x0, y0). The characters are displayed in the 
+// font specified by oled.font. Option for how the 
 // characters are displayed can be found in the user
-// manual and can be set using oled_SetTextMode()
+// manual and can be set using oled_SetTextMode().
+// Each character is placed right after the
+// previous one. Each line of the string is
+// composed in RAM and drawn into GRAM in one go,
+// then sent to the display as a single block
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
@@ -604,398 +1554,1939 @@ void oled_DispChar(oled_t * oled, int x0, int y0, const char c){
 //========================================
 void oled_DispString(oled_t * oled, int x0, int y0, const char * s){
     int i = 0, j = 0;
-    while(s[i] != '\0'){                                                // iterate through chars in string until NUL '\0' is reached
+    while(1){                                                           // iterate through chars in string until NUL '\0' is reached
+        if ((s[i] == '\n') || (s[i] == '\0')){                          // end of line, display it
+            if (i > j) DispLine(oled, x0, y0, &s[j], i - j);
+            if (s[i] == '\0') break;
+            y0 += oled->font->height;                                   // ENTER char, start new line
+            j = i + 1;
+        }
+        i++;
+    }
+}
+
+//========================================
+// oled_MeasureString()
+// this function returns the size of the area
+// oled_DispString() draws the string s in,
+// without drawing anything (e.g. to clear the
+// previous text before displaying new text
+// of a different length)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     s - pointer to the string
+//     width - set to the width of the widest line
+//             (0 if the string has no characters)
+//     height - set to the height from the top of
+//              the first line to the bottom of the 
+//              last line holding characters
+//========================================
+void oled_MeasureString(oled_t * oled, const char * s, int * width, int * height){
+    int i = 0, x = 0, lines = 0;
+    *width = 0;
+    *height = 0;
+    while(s[i] != '\0'){
         if (s[i] == '\n'){                                              // ENTER char, start new line
-            y0 += oled->font->height;                                   
-            j = 0;
+            lines++;
+            x = 0;
         }
         else {
-            oled_DispChar(oled, x0 + j*oled->font->width, y0, s[i]);    // display char
-            j++;
+            x += CharWidth(oled->font, s[i]);
+            if (x > *width) *width = x;
+            *height = (lines + 1)*oled->font->height;
         }
         i++;
     }
 }
 
-//======================================
-// SetPageAddress()
-// this function sets the oled's page start 
-// address and page stop address.
+//======================================
+// OpenWindow()
+// this function adds the Set Page Address
+// and Set Column Address commands that open
+// the window bounded by columns x0-x1 and 
+// pages p0-p1 to the current transfer. Pixel
+// data can then follow in the same transfer
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - column start address (integer in range 0-127)
+//     p0 - page start address (integer in range 0-7)
+//     x1 - column end address (integer in range 0-127)
+//     p1 - page end address (integer in range 0-7)
+//======================================
+void OpenWindow(oled_t * oled, int x0, int p0, int x1, int p1)
+{
+    uint8 cmds[OLED_WINDOW_CMDS_SIZE];
+    cmds[0] = SSD1306_SETPAGEADDRESS;               // Set Page Address command
+    cmds[1] = p0;                                   // page start address
+    cmds[2] = p1;                                   // page stop address
+    cmds[3] = SSD1306_SETCOLUMNADDRESS;             // Set Column Address command
+    cmds[4] = x0;                                   // column start address
+    cmds[5] = x1;                                   // column stop address
+    oled->transport->WriteCmds(oled->transport->bus, cmds, OLED_WINDOW_CMDS_SIZE);
+}
+
+//======================================
+// WriteGRAM()
+// this functions writes the specified color to
+// the rectangular block of GRAM defined by
+// its upper left corner (x0, y0) and lower right
+// corner (x1, y1), relative to the origin and
+// limited to the clip rectangle (see 
+// oled_PushClip()), and passes the block on to
+// the display (see UpdateDisplay())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//     color - 0 to clear the block, 1 to fill it,
+//             OLED_INVERT to invert it, OLED_KEEP
+//             to leave it as it is
+//======================================
+void WriteGRAM(oled_t * oled, int x0, int y0, int x1, int y1, uint8 color)
+{
+    if (color == OLED_KEEP) return;                     // nothing to draw
+    const oled_clip_t * clip = &oled->clip;
+    x0 += clip->ox;                                     // display coordinates
+    y0 += clip->oy;
+    x1 += clip->ox;
+    y1 += clip->oy;
+    if (x0 < clip->x0) x0 = clip->x0;                   // ensure x0, y0, x1, y1 are within the clip rectangle
+    if (x1 > clip->x1) x1 = clip->x1;
+    if (x1 < x0) return;                                                
+    if (y0 < clip->y0) y0 = clip->y0;
+    if (y1 > clip->y1) y1 = clip->y1;
+    if (y1 < y0) return;
+    
+    FillGRAM(oled, x0, y0, x1, y1, color);              // fill the block
+    UpdateDisplay(oled, x0, y0/8, x1, y1/8);            // pass the modified block on to the display
+}
+
+//======================================
+// FillGRAM()
+// this functions writes the specified color to
+// the rectangular block of GRAM defined by
+// its upper left corner (x0, y0) and lower right
+// corner (x1, y1), which must be on the display.
+// Each page of the block is handed to the fill
+// kernel of the operation (see FILL_KERNEL());
+// pages covered from top to bottom are simply 
+// set or cleared. The display is not updated
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//     color - 0 to clear the block, 1 to fill it,
+//             OLED_INVERT to invert it
+//======================================
+void FillGRAM(oled_t * oled, int x0, int y0, int x1, int y1, uint8 color)
+{
+    uint8 * p = &oled->GRAM[(y0/8)*OLED_WIDTH + x0];    // first byte of the block on the current page
+    int n = x1 - x0 + 1;                                // bytes of the block on each page
+    
+    for (int i=y0/8; i<=y1/8; i++, p+=OLED_WIDTH){      // iterate over pages that will be modified
+        uint8 bits = 0xFF;                              // rows of the page inside the block
+        if (i == y0/8) bits &= 0xFF << (y0 & 0x07);
+        if (i == y1/8) bits &= 0xFF >> (7 - (y1 & 0x07));
+        if (color == OLED_INVERT) InvertBytes(p, n, bits);
+        else if (bits == 0xFF) memset(p, (color == 0) ? 0x00 : 0xFF, n);  // whole bytes
+        else if (color == 0) ClearBytes(p, n, bits);
+        else SetBytes(p, n, bits);
+    }
+}
+
+//======================================
+// fill kernels
+// FILL_KERNEL(name, op, flip) defines the
+// function name(p, n, bits), which applies 
+// "byte op (bits ^ flip)" to the n bytes of
+// GRAM starting at p: a byte at a time up to
+// the first 32-bit boundary, then 4 bytes (4
+// columns) at a time through gram_word_t, 
+// which may alias the GRAM bytes, then the
+// bytes left.
+// Each operation gets its own loop, with no
+// tests on the color inside it
+//
+// Parameters (of the functions defined):
+//     p - first byte
+//     n - number of bytes
+//     bits - rows of the page to operate on
+//======================================
+#define FILL_KERNEL(name, op, flip)                                                     \
+void name(uint8 * p, int n, uint8 bits)                                                 \
+{                                                                                       \
+    uint8 b = bits ^ (flip);                            /* operand for a byte */        \
+    uint32 w = b * 0x01010101UL;                        /* operand for 4 bytes */       \
+    for (; (n > 0) && (((uintptr_t)p & 0x03) != 0); n--) *p++ op b;                     \
+    for (; n >= 4; n -= 4, p += 4) *(gram_word_t *)p op w;                               \
+    for (; n > 0; n--) *p++ op b;                                                       \
+}
+
+FILL_KERNEL(SetBytes, |=, 0x00)                         // set the rows
+FILL_KERNEL(ClearBytes, &=, 0xFF)                       // clear the rows
+FILL_KERNEL(InvertBytes, ^=, 0x00)                      // invert the rows
+
+//======================================
+// RasterOp()
+// this function returns the GRAM operation
+// that draws pixels in the given color with
+// the current raster operation (see
+// oled_SetRasterOp())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     color - 0 (black) or 1 (white)
+//
+// Returns:
+//     0 (clear), 1 (fill), OLED_INVERT or 
+//     OLED_KEEP (see WriteGRAM())
+//======================================
+uint8 RasterOp(oled_t * oled, uint8 color)
+{
+    switch (oled->rop){
+        case OLED_ROP_OR:                               // white turns pixels on
+            return color ? 1 : OLED_KEEP;
+        case OLED_ROP_AND_NOT:                          // white turns pixels off
+            return color ? 0 : OLED_KEEP;
+        case OLED_ROP_XOR:                              // white inverts pixels
+            return color ? OLED_INVERT : OLED_KEEP;
+        default:                                        // pixels take the color
+            return color;
+    }
+}
+
+//======================================
+// UpdateDisplay()
+// this function is called after a block of
+// GRAM has been modified. In OLED_UPDATE_IMMEDIATE
+// mode the block is sent to the display right
+// away, in OLED_UPDATE_DEFERRED mode its columns
+// are added to the dirty columns of each of its
+// pages, to be sent by the next oled_Flush()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - left column of the block
+//     p0 - top page of the block
+//     x1 - right column of the block
+//     p1 - bottom page of the block
+//======================================
+void UpdateDisplay(oled_t * oled, int x0, int p0, int x1, int p1)
+{
+    if ((oled->updateMode == OLED_UPDATE_IMMEDIATE) && (oled->GRAM == oled->txGRAM)){     // (the back buffer of a double buffered oled is only sent by oled_Present())
+        SendGRAM(oled, x0, p0, x1, p1);                 // send block now
+        return;
+    }
+    for (int i=p0; i<=p1; i++){
+        if (oled->dirtyX1[i] < oled->dirtyX0[i]){       // first modification of the page since the last flush
+            oled->dirtyX0[i] = x0;
+            oled->dirtyX1[i] = x1;
+        }
+        else {
+            if (x0 < oled->dirtyX0[i]) oled->dirtyX0[i] = x0;   // grow the dirty columns of the page to include the block
+            if (x1 > oled->dirtyX1[i]) oled->dirtyX1[i] = x1;
+        }
+    }
+}
+
+//======================================
+// UpdatePages()
+// this function is called after columns
+// x0[p]-x1[p] of each page p of GRAM have been
+// modified (x1[p] < x0[p] if page p was not).
+// It works like UpdateDisplay(), except that in
+// OLED_UPDATE_IMMEDIATE mode the pages are sent
+// in as few windows as pays off (see SendPages())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - left modified column of each page
+//     x1 - right modified column of each page
+//======================================
+void UpdatePages(oled_t * oled, const uint8 * x0, const uint8 * x1)
+{
+    if ((oled->updateMode == OLED_UPDATE_IMMEDIATE) && (oled->GRAM == oled->txGRAM)){
+        SendPages(oled, x0, x1);                        // send the pages now
+        return;
+    }
+    for (int i=0; i<OLED_HEIGHT/8; i++){
+        if (x1[i] >= x0[i]) UpdateDisplay(oled, x0[i], i, x1[i], i);   // mark the columns dirty
+    }
+}
+
+//======================================
+// SendPages()
+// this function sends columns x0[p]-x1[p] of
+// each page p of GRAM (none if x1[p] < x0[p])
+// to the display. Neighbouring pages share a
+// window when that costs less than opening
+// one window each (see windowCost in
+// oled_transport_t), even if the window
+// covers a few more columns or clean pages
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - left column to send of each page
+//     x1 - right column to send of each page
+//======================================
+void SendPages(oled_t * oled, const uint8 * x0, const uint8 * x1)
+{
+    int cost[OLED_HEIGHT/8 + 1];                        // cost[p]: cheapest way to send the dirty parts of pages 0 to p-1
+    int first[OLED_HEIGHT/8 + 1];                       // first[p]: top page of the last window in that solution
+    int c0, c1;
+
+    cost[0] = 0;
+    for (int p=1; p<=OLED_HEIGHT/8; p++){               // find the cheapest set of windows, one page at a time
+        cost[p] = cost[p-1];                            // a clean page costs nothing
+        first[p] = p;
+        if (x1[p-1] < x0[p-1]) continue;
+        c0 = OLED_WIDTH - 1;
+        c1 = 0;
+        cost[p] = -1;
+        for (int i=p-1; i>=0; i--){                     // try every window that ends on page p-1
+            if (x1[i] < x0[i]) continue;                // windows start on a dirty page (but may span clean ones)
+            if (x0[i] < c0) c0 = x0[i];
+            if (x1[i] > c1) c1 = x1[i];
+            int c = cost[i] + oled->transport->windowCost + (c1 - c0 + 1)*(p - i);
+            if ((cost[p] < 0) || (c < cost[p])){
+                cost[p] = c;
+                first[p] = i;
+            }
+        }
+    }
+
+    int p = OLED_HEIGHT/8;
+    while (p > 0){                                      // send the chosen windows (bottom to top)
+        if (first[p] == p){                             // clean page
+            p--;
+            continue;
+        }
+        c0 = OLED_WIDTH - 1;
+        c1 = 0;
+        for (int i=first[p]; i<p; i++){                 // columns covered by the window
+            if (x1[i] < x0[i]) continue;
+            if (x0[i] < c0) c0 = x0[i];
+            if (x1[i] > c1) c1 = x1[i];
+        }
+        SendGRAM(oled, c0, first[p], c1, p-1);
+        p = first[p];
+    }
+}
+
+//======================================
+// SendGRAM()
+// this function sends the block of GRAM
+// bounded by columns x0-x1 and pages p0-p1
+// to the display. The window commands and
+// the data share a single transaction. With
+// a background transport (see oled_SetTransport())
+// the block is queued instead
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - left column of the block
+//     p0 - top page of the block
+//     x1 - right column of the block
+//     p1 - bottom page of the block
+//======================================
+void SendGRAM(oled_t * oled, int x0, int p0, int x1, int p1)
+{
+    oled_transport_t * t = oled->transport;
+    if (t->Busy != NULL){                               // background transfers: queue the block and return
+        QueueGRAM(oled, x0, p0, x1, p1);
+        return;
+    }
+
+    OpenWindow(oled, x0, p0, x1, p1);                   // set the page and column addresses
+    for (int i=p0; i<=p1; i++){                         // iterate over pages
+        t->WriteData(t->bus, &oled->txGRAM[i*OLED_WIDTH + x0], x1 - x0 + 1);   // write the page's columns to the display
+        UpdateShadow(oled, i*OLED_WIDTH + x0, x1 - x0 + 1);
+    }
+    t->Flush(t->bus);                                   // end the transfer
+}
+
+//======================================
+// QueueGRAM()
+// this function queues the block of GRAM
+// bounded by columns x0-x1 and pages p0-p1
+// for a background transfer. Columns
+// already queued on the same page are merged
+// with the block. The data itself is read 
+// from txGRAM when the page's transfer starts
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - left column of the block
+//     p0 - top page of the block
+//     x1 - right column of the block
+//     p1 - bottom page of the block
+//======================================
+void QueueGRAM(oled_t * oled, int x0, int p0, int x1, int p1)
+{
+    for (int i=p0; i<=p1; i++){
+        if (oled->queueX1[i] < oled->queueX0[i]){       // nothing queued on the page yet
+            oled->queueX0[i] = x0;
+            oled->queueX1[i] = x1;
+        }
+        else {
+            if (x0 < oled->queueX0[i]) oled->queueX0[i] = x0;
+            if (x1 > oled->queueX1[i]) oled->queueX1[i] = x1;
+        }
+    }
+    oled_IsBusy(oled);                                  // start transferring if the bus is free
+}
+
+//======================================
+// UpdateShadow()
+// this function records count bytes of 
+// txGRAM, starting at offset, that have been
+// sent to the display in the shadow copy of
+// the display (if there is one)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     offset - index of the first byte in txGRAM
+//     count - number of bytes
+//======================================
+void UpdateShadow(oled_t * oled, int offset, int count)
+{
+    if (oled->shadow == NULL) return;
+    for (int i=offset; i<offset+count; i++){
+        oled->shadow[i] = oled->txGRAM[i];              // keep track of what the display holds
+    }
+}
+
+//======================================
+// TransposeTile()
+// this function turns a tile of 8x8 pixels
+// stored as rows (.xbm format: one byte per
+// row, bit 0 = leftmost pixel) into columns
+// (GRAM format: one byte per column, bit 0 =
+// top pixel). The tile is transposed as two 
+// 32-bit words by swapping blocks of 4x4, 2x2
+// and 1x1 pixels across the diagonal
+//
+// Parameters:
+//     rows - first row of the tile
+//     stride - bytes from one row to the next
+//     count - number of rows (missing rows are blank)
+//     cols - array of 8 bytes that receives the columns
+//======================================
+void TransposeTile(const uint8 * rows, int stride, int count, uint8 * cols)
+{
+    uint32 lo = 0, hi = 0, t;                           // rows 0-3 and rows 4-7, one byte each
+    for (int i=0; i<count; i++){
+        if (i < 4) lo |= (uint32)rows[i*stride] << (8*i);
+        else hi |= (uint32)rows[i*stride] << (8*(i - 4));
+    }
+    t = ((lo >> 4) ^ hi) & 0x0F0F0F0F;                  // swap the top right and bottom left 4x4 blocks
+    hi ^= t;
+    lo ^= t << 4;
+    t = (lo ^ (lo >> 14)) & 0x0000CCCC;                 // swap 2x2 blocks within each 4x4 block
+    lo ^= t ^ (t << 14);
+    t = (hi ^ (hi >> 14)) & 0x0000CCCC;
+    hi ^= t ^ (t << 14);
+    t = (lo ^ (lo >> 7)) & 0x00AA00AA;                  // swap pixels within each 2x2 block
+    lo ^= t ^ (t << 7);
+    t = (hi ^ (hi >> 7)) & 0x00AA00AA;
+    hi ^= t ^ (t << 7);
+    for (int i=0; i<4; i++){
+        cols[i] = lo >> (8*i);
+        cols[i + 4] = hi >> (8*i);
+    }
+}
+
+//======================================
+// BlendGRAM()
+// this function draws up to 8 pixels of a
+// bitmap into one byte of GRAM according to
+// the bitmap mode (see oled_SetBmMode()). 
+// Does not update the display
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x - column
+//     p - page (nothing is drawn outside pages 0-7)
+//     bits - pixel values of the bitmap (bit 0 = top)
+//     mask - pixels of the byte covered by the bitmap
+//
+// Returns:
+//     1 if any pixel was drawn, 0 if all of them
+//     were transparent, left as they were by the
+//     raster operation (see oled_SetRasterOp())
+//     or outside the display
+//======================================
+uint8 BlendGRAM(oled_t * oled, int x, int p, uint8 bits, uint8 mask)
+{
+    if ((p < 0) || (p > OLED_HEIGHT/8 - 1) || (mask == 0)) return 0;
+    uint8 fg, bk;                                       // pixels drawn in the foreground and background colors
+    uint8 on, off;                                      // pixels turned on and off
+    switch (oled->bmMode){
+        case OLED_BM_NORMAL:                            // bitmap displayed "as is"
+            on = bits & mask;
+            off = ~bits & mask;
+            break;
+        case OLED_BM_INV:                               // bitmap displayed with pixels inverted
+            on = ~bits & mask;
+            off = bits & mask;
+            break;
+        default:
+            fg = bits & mask;                           // white pixels in the forground color...
+            bk = ~bits & mask;
+            if ((oled->bmMode == OLED_BM_BLACK_TRAN) || (oled->bmMode == OLED_BM_BLACK_FILL)){   // ...or black pixels
+                fg = ~bits & mask;
+                bk = bits & mask;
+            }
+            if ((oled->bmMode == OLED_BM_WHITE_TRAN) || (oled->bmMode == OLED_BM_BLACK_TRAN)) bk = 0;  // the other pixels are transparent
+            on = (oled->color ? fg : 0) | (oled->bkColor ? bk : 0);
+            off = (oled->color ? 0 : fg) | (oled->bkColor ? 0 : bk);
+            break;
+    }
+    uint8 * g = &oled->GRAM[p*OLED_WIDTH + x];
+    switch (oled->rop){                                 // combine the pixels turned on (white) with GRAM
+        case OLED_ROP_OR:
+            *g |= on;
+            return on != 0;
+        case OLED_ROP_AND_NOT:
+            *g &= ~on;
+            return on != 0;
+        case OLED_ROP_XOR:
+            *g ^= on;
+            return on != 0;
+        default:
+            *g = (*g & ~off) | on;
+            return (on | off) != 0;
+    }
+}
+
+//======================================
+// BlitColumn()
+// this function draws one column of up to 8
+// pixels of a bitmap into GRAM (see BlendGRAM()).
+// The column's top pixel lands on row shift of
+// page p, the pixels below row 7 on page p+1.
+// Bytes of GRAM drawn in are added to block
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x - column
+//     p - page
+//     shift - row of page p the top pixel lands on (0-7)
+//     bits - pixel values (bit 0 = top)
+//     mask - pixels covered by the bitmap
+//     block - left column, top page, right column 
+//             and bottom page of the block drawn in
+//======================================
+void BlitColumn(oled_t * oled, int x, int p, int shift, uint8 bits, uint8 mask, int * block)
+{
+    if (BlendGRAM(oled, x, p, bits << shift, mask << shift)) GrowBlock(block, x, p);    // upper part of the column
+    if (shift == 0) return;
+    if (BlendGRAM(oled, x, p + 1, bits >> (8 - shift), mask >> (8 - shift))) GrowBlock(block, x, p + 1);  // lower part, in the next page
+}
+
+//======================================
+// GrowBlock()
+// this function grows a block of GRAM to
+// include the byte at column x of page p
+//
+// Parameters:
+//     block - left column, top page, right column
+//             and bottom page of the block
+//     x - column
+//     p - page
+//======================================
+void GrowBlock(int * block, int x, int p)
+{
+    if (x < block[0]) block[0] = x;
+    if (p < block[1]) block[1] = p;
+    if (x > block[2]) block[2] = x;
+    if (p > block[3]) block[3] = p;
+}
+
+//======================================
+// DispLine()
+// this function displays the n characters
+// of s side by side with the top left corner
+// of the first one at (x0, y0). The line is
+// composed one page at a time in RAM, drawn
+// into GRAM (see BlitColumn()) and sent to the
+// display as a single block. Characters out of
+// range are left blank
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate for upper left corner of 
+//          the first character
+//     y0 - y-coordinate for upper left corner of 
+//          the first character
+//     s - pointer to the characters
+//     n - number of characters
+//======================================
+void DispLine(oled_t * oled, int x0, int y0, const char * s, int n)
+{
+    const font_t * font = oled->font;
+    int bx0 = 0, by0 = 0, bx1 = -1, by1 = font->height - 1; // part of the line inside the clip rectangle
+    for (int k=0; k<n; k++) bx1 += CharWidth(font, s[k]);
+    const oled_clip_t * clip = &oled->clip;
+    x0 += clip->ox;                                     // display coordinates
+    y0 += clip->oy;
+    if (x0 < clip->x0) bx0 = clip->x0 - x0;
+    if (y0 < clip->y0) by0 = clip->y0 - y0;
+    if (x0 + bx1 > clip->x1) bx1 = clip->x1 - x0;
+    if (y0 + by1 > clip->y1) by1 = clip->y1 - y0;
+    if ((bx1 < bx0) || (by1 < by0)) return;
+
+    uint8 bmMode = oled_GetBmMode(oled);                // store current bitmap mode
+    oled_SetBmMode(oled, oled->textMode);               // set bmMode to text mode
+    uint8 strip[OLED_WIDTH];                            // one page of the line
+    int shift = y0 & 0x07;                              // row of its page that the top of each page of the line lands on
+    int block[4] = {OLED_WIDTH, OLED_HEIGHT/8, -1, -1}; // block of GRAM actually drawn in
+    for (int t=by0/8; t<=by1/8; t++){                   // iterate over pages of the line
+        uint8 mask = 0xFF;                              // rows of the page that are on the display
+        if (8*t < by0) mask = mask << (by0 - 8*t);
+        if (8*t + 7 > by1) mask = mask & (0xFF >> (8*t + 7 - by1));
+        int p = (y0 + 8*t - shift)/8;                   // page of GRAM the top of the page lands on
+        int cx = 0;                                     // column of the line the character starts at
+        for (int k=0; (k < n) && (cx <= bx1); k++){     // compose the page from the characters' pages
+            int w = CharWidth(font, s[k]);
+            int c0 = (bx0 > cx) ? bx0 - cx : 0;         // columns of the character on the display
+            int c1 = (cx + w - 1 > bx1) ? bx1 - cx : w - 1;
+            if (c0 <= c1){
+                if (((uint8)s[k] < font->first) || ((uint8)s[k] > font->last)) memset(&strip[cx + c0 - bx0], 0x00, c1 - c0 + 1);
+                else GlyphPage(font, (uint8)s[k] - font->first, t, c0, c1, &strip[cx + c0 - bx0]);
+            }
+            cx += w;
+        }
+        for (int x=bx0; x<=bx1; x++){
+            BlitColumn(oled, x0 + x, p, shift, strip[x - bx0], mask, block);
+        }
+    }
+    oled_SetBmMode(oled, bmMode);                       // restore bitmap mode
+    if (block[2] >= block[0]) UpdateDisplay(oled, block[0], block[1], block[2], block[3]);  // one block for the whole line
+}
+
+//======================================
+// GlyphPage()
+// this function copies columns c0-c1 of page t
+// of character i of a font (GRAM format, one
+// byte per column, bit 0 = top pixel), 
+// expanding compressed fonts on the way
+//
+// Parameters:
+//     font - pointer to a font_t structure
+//     i - character (index into the font)
+//     t - page of the character
+//     c0 - first column
+//     c1 - last column
+//     cols - where to copy the c1-c0+1 bytes
+//======================================
+void GlyphPage(const font_t * font, int i, int t, int c0, int c1, uint8 * cols)
+{
+    if (font->encoding == FONT_RLE){                    // expand the character up to the last column needed
+        rle_t rle = {&font->bitmaps[font->offsets[i]], 0, 0};
+        RLESkip(&rle, t*font->widths[i] + c0);
+        for (int c=c0; c<=c1; c++) cols[c - c0] = RLENext(&rle);
+        return;
+    }
+    memcpy(cols, &font->bitmaps[font->offsets[i] + t*font->widths[i] + c0], c1 - c0 + 1);
+}
+
+//======================================
+// CharWidth()
+// this function returns the width of
+// character c (characters out of range 
+// are as wide as the first character of 
+// the font)
+//
+// Parameters:
+//     font - pointer to a font_t structure
+//     c - character
+//======================================
+int CharWidth(const font_t * font, char c)
+{
+    if (((uint8)c < font->first) || ((uint8)c > font->last)) return font->widths[0];
+    return font->widths[(uint8)c - font->first];
+}
+
+//======================================
+// RLENext()
+// this function expands the next byte of
+// compressed data (see oled_DispRLEBitmap())
+//
+// Parameters:
+//     rle - pointer to the decoder state
+//
+// Returns:
+//     the byte
+//======================================
+uint8 RLENext(rle_t * rle)
+{
+    if (rle->left == 0){                                // start of a packet
+        uint8 c = *rle->src++;
+        rle->repeat = (c & OLED_RLE_REPEAT) != 0;
+        rle->left = rle->repeat ? (c & 0x7F) + 2 : c + 1;
+    }
+    rle->left--;
+    if (!rle->repeat) return *rle->src++;
+    uint8 value = *rle->src;
+    if (rle->left == 0) rle->src++;                     // end of the repeated byte's packet
+    return value;
+}
+
+//======================================
+// RLESkip()
+// this function skips count bytes of 
+// compressed data, a packet at a time
+//
+// Parameters:
+//     rle - pointer to the decoder state
+//     count - number of (expanded) bytes
+//======================================
+void RLESkip(rle_t * rle, int count)
+{
+    while (count > 0){
+        if (rle->left == 0){                            // start of a packet
+            uint8 c = *rle->src++;
+            rle->repeat = (c & OLED_RLE_REPEAT) != 0;
+            rle->left = rle->repeat ? (c & 0x7F) + 2 : c + 1;
+        }
+        int n = (count < rle->left) ? count : rle->left;
+        rle->left -= n;
+        count -= n;
+        if (!rle->repeat) rle->src += n;
+        else if (rle->left == 0) rle->src++;
+    }
+}
+
+//======================================
+// MarkClean()
+// this function marks pages p0-p1 as
+// matching the display (nothing left to flush)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     p0 - first page
+//     p1 - last page
+//======================================
+void MarkClean(oled_t * oled, int p0, int p1)
+{
+    for (int i=p0; i<=p1; i++){
+        oled->dirtyX0[i] = OLED_WIDTH - 1;
+        oled->dirtyX1[i] = 0;
+    }
+}
+
+//========================================
+// DrawHLine()
+// this functions draws a horizontal line
+// between the points (x0, y) and (x1, y)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     y - y-coordinate of line
+//     x0 - x-coordinate of the first point
+//     x1 - x-coordinate of the second point
+//========================================
+void DrawHLine(oled_t * oled, int y, int x0, int x1)
+{
+    if (x0 <= x1) WriteGRAM(oled, x0-oled->penSize, y-oled->penSize, x1+oled->penSize, y+oled->penSize, RasterOp(oled, oled->color));   // draw horizontal line (x0 <= x1)
+    else WriteGRAM(oled, x1-oled->penSize, y-oled->penSize, x0+oled->penSize, y+oled->penSize, RasterOp(oled, oled->color));            // draw horizontal line (x0 > x1)
+}
+
+//========================================
+// DrawVLine()
+// this functions draws a vertical line
+// between the points (x, y0) and (x, y1)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x - x-coordinate of line
+//     y0 - y-coordinate of the first point
+//     y1 - y-coordinate of the second point
+//========================================
+void DrawVLine(oled_t * oled, int x, int y0, int y1)
+{
+    if (y0 <= y1) WriteGRAM(oled, x-oled->penSize, y0-oled->penSize, x+oled->penSize, y1+oled->penSize, RasterOp(oled, oled->color));   // draw vertical line (y0 <= y1)
+    else WriteGRAM(oled, x-oled->penSize, y1-oled->penSize, x+oled->penSize, y0+oled->penSize, RasterOp(oled, oled->color));            // draw vertical line (y0 > y1)
+}
+
+//========================================
+// BresenhamLineAlgorithm()
+// this function uses Bresenham's line algorithm to
+// draw a line between the points (x0, y0) and 
+// (x0+dx, y0+dy). Bresenham's algorithm requires
+// the slope of the line to be between 0 and 1, however
+// the parameter rot allows the caller to specify 
+// whether the line should be rotated when plotted 
+// on the display. The pixels are collected into
+// one span per row (per column for steep lines),
+// each of which is then drawn with a single GRAM
+// operation (see DrawSpans())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate of the start of the line
+//     y0 - y-coordinate of the start of the line
+//     dx - length of the line in the x-direction
+//     dy - length of the line in the y-direction
+//     rot - desired rotation (integer in range 0-3)
+//========================================
+void BresenhamLineAlgorithm(oled_t * oled, int x0, int y0, int dx, int dy, uint8 rot)
+{
+    if ((dx < 0) || (dy < 0) || (dy > dx)) return;              // make sure the slope is between 0 and 1
+    
+    int error = 0;                                              // initialize error to 0 
+    int x = 0, y = 0;                                           // set x and y to 0 (start algorithm at the origin)
+    int thresh = dx - 2*dy;                                     // decision threshold (increase y if error becomes greater than thresh)
+    uint8 step = 0;                                             // this variable keeps track of whether y was incrementd on the previous itteration (1 if y was incremented, 0 otherwise)
+    span_t * span = &lineSpan;                                  // the rows (columns) of the line
+    
+    span->vertical = ((rot == 0) || (rot == 3));                // steep lines are drawn one column at a time
+    for (int i=0; i<OLED_WIDTH; i++){                           // all spans empty
+        span->s0[i] = OLED_WIDTH;
+        span->s1[i] = -1;
+    }
+    for(; x<=dx; x++){                                          // iterate over  x coordinates
+        if ((x == 0) && (-2*dy + 2*dx > thresh)) step = 1;      // set step = 1 if a step would have been made right before the begining of the line
+        PlotPerpLineL(oled, span, x0, y0, dx, dy, x, y, step, rot);
+        PlotPerpLineR(oled, span, x0, y0, dx, dy, x, y, step, rot);
+        if (error > thresh){                                    // check decision threshold
+            y++;                                                // increment the y coordinate
+            error += 2*dy - 2*dx;                               // update the error
+            step = 1;                                           // step was made, so set step to 1
+        }
+        else {
+            error += 2*dy;                                      // update the error
+            step = 0;                                           // step was not made, so set step to 0
+        }
+    }
+    DrawSpans(oled, span);                                      // draw the line
+}
+
+//========================================
+// PlotPerpLineL()
+// this function is a helper function for 
+// BresenhamLineAlgorithm(). It uses a modified 
+// version of Bresenham's line algorithm to add
+// thickness to the line being drawn in BresenhamLineAlgorithm().
+// It does this by plotting a perpendicular line
+// to the left side of the line being drawn. The 
+// starting point for this perpendicular line is
+// the point (x0+x, y0+y)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     span - spans of the line
+//     x0 - x-coordinate of the start of the line
+//     y0 - y-coordinate of the start of the line
+//     dx - length of the line in the x-direction
+//     dy - length of the line in the y-direction
+//     x - x-coordinate offset for the starting point
+//         of the perpendicular line
+//     y - y-coordinate offset for the starting point
+//         of the perpendicular line
+//     step - binary value which indicates if the y 
+//            offset was increment in the previous
+//            iteration of Bresenham's algorithm     
+//     rot - desired rotation (integer in range 0-3)
+//
+// Note: the "line" refered to in the parameter descriptions
+// is used in reference to the line being drawn in
+// BresenhamLineAlgorithm() unless stated otherwise
+//========================================
+void PlotPerpLineL(oled_t * oled, span_t * span, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot)
+{
+    int error = 0;
+    int thresh = dx - 2*dy;             // decision threshold (decrease x if error becomes greater than thresh)
+    
+    for (int i=0; i<oled->penSize+1; i++){
+        PlotPoint(span, x0, y0, x, y, rot); // plot pixel
+        if (error > thresh){            // check decision threshold
+            x--;                        // decrement the x coordinate
+            error += 2*dy - 2*dx;       // update the error
+            if ((step == 1) && (i != oled->penSize)){
+                PlotPoint(span, x0, y0, x, y, rot);      // fill in "gap" pixel      
+            }
+        }
+        else {
+            error += 2*dy;              // update the error   
+        }
+        y++;                            // increment y on every itteratioon
+    }
+}
+
+//========================================
+// PlotPerpLineR()
+// this function is a helper function for 
+// BresenhamLineAlgorithm(). It uses a modified 
+// version of Bresenham's line algorithm to add
+// thickness to the line being drawn in BresenhamLineAlgorithm().
+// It does this by plotting a perpendicular line
+// to the right side of the line being drawn. The 
+// starting point for this perpendicular line is
+// the point (x0+x, y0+y)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     span - spans of the line
+//     x0 - x-coordinate of the start of the line
+//     y0 - y-coordinate of the start of the line
+//     dx - length of the line in the x-direction
+//     dy - length of the line in the y-direction
+//     x - x-coordinate offset for the starting point
+//         of the perpendicular line
+//     y - y-coordinate offset for the starting point
+//         of the perpendicular line
+//     step - binary value which indicates if the y 
+//            offset was increment in the previous
+//            iteration of Bresenham's algorithm     
+//     rot - desired rotation (integer in range 0-3)
+//
+// Note: the "line" refered to in the parameter descriptions
+// is used in reference to the line being drawn in
+// BresenhamLineAlgorithm() unless stated otherwise
+//========================================
+void PlotPerpLineR(oled_t * oled, span_t * span, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot)
+{
+    int error = 0;
+    int thresh = dx - 2*dy;             // decision threshold (increase x if error becomes greater than thresh)
+    
+    for (int i=0; i<oled->penSize+1; i++){
+        if (i != 0) PlotPoint(span, x0, y0, x, y, rot);     // plot pixel (don't plot the first pixel. This will have already been plotted by PlotPerpLineL()
+        if (error > thresh){            // check decision threshold
+            x++;                        // increment the x coordinate
+            error += 2*dy - 2*dx;       // update the error
+            if ((step == 1) && (i != oled->penSize)){
+                PlotPoint(span, x0, y0, x-1, y-1, rot);             // fill in "gap" pixel    
+            }
+        }
+        else {
+            error += 2*dy;              // update the error   
+        }
+        y--;                            // decrement y on every itteratioon
+    }
+}
+
+//========================================
+// PlotPoint()
+// this function is a helper function for 
+// PlotPerpLineL()/PlotPerpLineR(). It adds
+// the points calculated by the line algorithms
+// to the spans of the line with the specified
+// rotation (i.e the transformation necesssary
+// to draw lines with slopes less than 0 or
+// greater than 1)
+//
+// Parameters:
+//     span - spans of the line
+//     x0 - x-coordinate of the start of the line
+//     y0 - y-coordinate of the start of the line
+//     x - x-coordinate offset for the starting point
+//         of the perpendicular line
+//     y - y-coordinate offset for the starting point
+//         of the perpendicular line    
+//     rot - desired rotation (integer in range 0-3)
+//
+// Note: the "line" refered to in the parameter descriptions
+// is used in reference to the line being drawn in
+// BresenhamLineAlgorithm() unless stated otherwise
+//========================================
+void PlotPoint(span_t * span, int x0, int y0, int x, int y, uint8 rot)
+{
+    if (rot == 0) AddToSpan(span, y0+y, x0+x);                  // slope > 1
+    else if (rot == 1) AddToSpan(span, x0+x, y0+y);             // 0 <= slope <= 1
+    else if (rot == 2) AddToSpan(span, x0+x, -y0-y);            // -1 <= slope < 0
+    else if (rot == 3) AddToSpan(span, y0+y, -x0-x);            // slope < -1
+}
+
+//========================================
+// AddToSpan()
+// this function grows the span of the row
+// (column for vertical spans) of the pixel
+// at (x, y) to include the pixel. Pixels of
+// rows (columns) off the display are dropped
+//
+// Parameters:
+//     span - spans of the line
+//     x - x-coordinate of the pixel
+//     y - y-coordinate of the pixel
+//========================================
+void AddToSpan(span_t * span, int x, int y)
+{
+    int row = y, pos = x, rows = OLED_HEIGHT, length = OLED_WIDTH;    // row of the span and position of the pixel in it
+    if (span->vertical){
+        row = x;
+        pos = y;
+        rows = OLED_WIDTH;
+        length = OLED_HEIGHT;
+    }
+    if ((row < 0) || (row >= rows)) return;             // row (column) is off the display
+    if (pos < -1) pos = -1;                             // pixels off the ends of the row are kept just off the display
+    if (pos > length) pos = length;
+    if (pos < span->s0[row]) span->s0[row] = pos;
+    if (pos > span->s1[row]) span->s1[row] = pos;
+}
+
+//========================================
+// DrawSpans()
+// this function draws the spans of a line in
+// the foreground color (see RasterOp()), each
+// with a single GRAM operation (see FillGRAM()),
+// and passes the columns drawn in on each page
+// on to the display (see UpdatePages())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     span - spans of the line
+//========================================
+void DrawSpans(oled_t * oled, span_t * span)
+{
+    uint8 x0[OLED_HEIGHT/8], x1[OLED_HEIGHT/8];         // columns drawn in on each page (x1 < x0 if none)
+    const oled_clip_t * clip = &oled->clip;
+    int row0 = span->vertical ? clip->x0 : clip->y0;    // rows (columns) inside the clip rectangle
+    int row1 = span->vertical ? clip->x1 : clip->y1;
+    int pos0 = span->vertical ? clip->y0 : clip->x0;    // and the part of each inside it
+    int pos1 = span->vertical ? clip->y1 : clip->x1;
+    uint8 op = RasterOp(oled, oled->color);
+    if (op == OLED_KEEP) return;                        // nothing to draw
+
+    memset(x0, OLED_WIDTH - 1, sizeof(x0));
+    memset(x1, 0, sizeof(x1));
+    for (int row=row0; row<=row1; row++){
+        int a = (span->s0[row] < pos0) ? pos0 : span->s0[row];           // part of the span inside the clip rectangle
+        int b = (span->s1[row] > pos1) ? pos1 : span->s1[row];
+        if (b < a) continue;
+        if (span->vertical){
+            FillGRAM(oled, row, a, row, b, op);                           // one column, a to b
+            for (int p=a/8; p<=b/8; p++){
+                if (row < x0[p]) x0[p] = row;
+                if (row > x1[p]) x1[p] = row;
+            }
+        }
+        else {
+            FillRow(oled, row, a, b, op, x0, x1);                         // one row, a to b
+        }
+    }
+    UpdatePages(oled, x0, x1);
+}
+
+//========================================
+// FillRow()
+// this function draws columns x0-x1 of row y
+// (inside the clip rectangle) with a GRAM operation
+// and grows the columns drawn in on its page
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     y - row
+//     x0 - first column
+//     x1 - last column
+//     op - GRAM operation (see RasterOp())
+//     px0 - left column drawn in on each page
+//     px1 - right column drawn in on each page
+//========================================
+void FillRow(oled_t * oled, int y, int x0, int x1, uint8 op, uint8 * px0, uint8 * px1)
+{
+    if (x0 < oled->clip.x0) x0 = oled->clip.x0;         // part of the row inside the clip rectangle
+    if (x1 > oled->clip.x1) x1 = oled->clip.x1;
+    if (x1 < x0) return;
+    FillGRAM(oled, x0, y, x1, y, op);
+    if (x0 < px0[y/8]) px0[y/8] = x0;
+    if (x1 > px1[y/8]) px1[y/8] = x1;
+}
+
+//========================================
+// BresenhamCircleAlgorithm()
+// this function uses Bresenham's circle algorithm to
+// draw a circle of radius r centered at (xc, yc)
+// (see RoundedCircleAlgorithm())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the circle
+//     yc - y-coordinate of the center of the circle
+//     rIn - radius of circle
+//     rOut - outer radius of circle
+//     octants - 8-bit number: xxxx xxxx. Each bit
+//               corresponds to an octant of the circle
+//               and should be set to 1 if that octant
+//               should be plotted (the LSB corresponds
+//               to the octant 0)
+//     sector - sector of the circle to draw (NULL
+//              for all of it)
+//========================================
+void BresenhamCircleAlgorithm(oled_t *oled, int xc, int yc, int rIn, int rOut, uint8 octants, const sector_t * sector)
+{
+    RoundedCircleAlgorithm(oled, xc, yc, xc, yc, rIn, rOut, octants, sector);     // a rectangle of one pixel
+}
+
+//========================================
+// RoundedCircleAlgorithm()
+// this function draws a circle whose four
+// quarters are centered at the corners of the
+// rectangle (xl, yt)-(xr, yb), with the
+// rectangle and the straight sides between the
+// quarters filled in (see DrawCircleSpans()).
+// The circle is first turned into spans, a 
+// left and a right one per row (see 
+// CircleSpans()), which are then filled once
+// each. The spans of small circles come from
+// the span cache, if there is one (see
+// oled_SetSpanCache()). A sector, if given,
+// further limits the circle to the angles it
+// covers (only if the rectangle is a point)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xl - x-coordinate of the centers of the left quarters
+//     yt - y-coordinate of the centers of the upper quarters
+//     xr - x-coordinate of the centers of the right quarters
+//     yb - y-coordinate of the centers of the lower quarters
+//     rIn - radius of circle
+//     rOut - outer radius of circle
+//     octants - octants of the circle (see 
+//               BresenhamCircleAlgorithm())
+//     sector - sector of the circle to draw (NULL
+//              for all of it)
+//========================================
+void RoundedCircleAlgorithm(oled_t * oled, int xl, int yt, int xr, int yb, int rIn, int rOut, uint8 octants, const sector_t * sector)
+{
+    if ((rIn > rOut) || (rOut <= 0)) return;    // inner radius must be less than or equal to the outer radius
+    const oled_clip_t * clip = &oled->clip;
+    xl += clip->ox;                             // display coordinates
+    xr += clip->ox;
+    yt += clip->oy;
+    yb += clip->oy;
+    if ((xr + rOut < clip->x0) || (xl - rOut > clip->x1) || (yb + rOut < clip->y0) || (yt - rOut > clip->y1)) return;  // outside the clip rectangle
+    oled_spans_t * local = &circleSpans;        // spans of a circle that is not cached
+    const oled_spans_t * spans = CachedSpans(oled, rIn, rOut, octants);
+    
+    if (spans == NULL){                         // only the rows inside the clip rectangle
+        int top = clip->y0 - yt;                // first row of the circle drawn
+        if (top > 0) top = (clip->y0 - yb > 0) ? clip->y0 - yb : 0;
+        int bottom = clip->y1 - yb;             // last row of the circle drawn
+        if (bottom < 0) bottom = (clip->y1 - yt < 0) ? clip->y1 - yt : 0;
+        local->top = (-rOut > top) ? -rOut : top;
+        if (bottom > rOut) bottom = rOut;
+        if (bottom < local->top) return;
+        local->rows = bottom - local->top + 1;
+        CircleSpans(local, rIn, rOut, octants);
+        spans = local;
+    }
+    DrawCircleSpans(oled, xl, yt, xr, yb, spans, sector);
+}
+
+//========================================
+// CachedSpans()
+// this function looks up the spans of a 
+// circle in the span cache. On a miss they
+// are computed into the least recently used 
+// entry
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     rIn - inner radius of circle
+//     rOut - outer radius of circle
+//     octants - octants of the circle (see 
+//               BresenhamCircleAlgorithm())
+//
+// Returns:
+//     the spans of the whole circle, NULL if 
+//     there is no cache or the circle is too
+//     large to be cached
+//========================================
+oled_spans_t * CachedSpans(oled_t * oled, int rIn, int rOut, uint8 octants)
+{
+    if ((oled->spanCacheSize == 0) || (rOut > OLED_SPAN_CACHE_RADIUS)) return NULL;
+    oled_span_cache_t * entry = NULL;           // entry holding the circle
+    oled_span_cache_t * oldest = NULL;          // least recently used other entry
+    
+    for (int i=0; i<oled->spanCacheSize; i++){
+        oled_span_cache_t * e = &oled->spanCache[i];
+        if ((e->rIn == rIn) && (e->rOut == rOut) && (e->octants == octants)){
+            entry = e;                          // hit
+            continue;
+        }
+        if (e->age < 255) e->age++;             // one more circle since it was used
+        if ((oldest == NULL) || (e->age > oldest->age)) oldest = e;
+    }
+    if (entry == NULL){                         // miss: replace the least recently used entry
+        if (oldest == NULL) return NULL;
+        entry = oldest;
+        entry->rIn = rIn;
+        entry->rOut = rOut;
+        entry->octants = octants;
+        entry->spans.top = -rOut;               // the whole circle
+        entry->spans.rows = 2*rOut + 1;
+        CircleSpans(&entry->spans, rIn, rOut, octants);
+    }
+    entry->age = 0;
+    return &entry->spans;
+}
+
+//========================================
+// CircleSpans()
+// this function computes the spans of rows
+// spans->top to spans->top + spans->rows - 1
+// (relative to the center) of a circle. Each
+// row gets a span for its left half and one
+// for its right half
+//
+// Parameters:
+//     spans - spans of the circle (top and rows
+//             set by the caller)
+//     rIn - inner radius of circle
+//     rOut - outer radius of circle
+//     octants - octants of the circle (see 
+//               BresenhamCircleAlgorithm())
+//========================================
+void CircleSpans(oled_spans_t * spans, int rIn, int rOut, uint8 octants)
+{
+    int dIn = 3 - 2*rIn;                        // initialize decision parameter for inner circle
+    int dOut = 3 - 2*rOut;                      // initialize decision parameter for inner circle
+    int x = 0, yIn = rIn, yOut = rOut;          // initialize first point on the inner cicle to (0, rIn) and first point on the outer cicle to (0, rOut)
+
+    for (int i=0; i<spans->rows; i++){          // all spans empty
+        spans->left[i][0] = 0x7FFF;
+        spans->left[i][1] = -0x7FFF;
+        spans->right[i][0] = 0x7FFF;
+        spans->right[i][1] = -0x7FFF;
+    }
+    while (yIn <= yOut){                        // itterate over x until x becomes larger than yIn
+        PlotCircle(spans, x, yIn, yOut, octants);
+        if (dOut < 0){                          // check outer circle desision parameter
+            dOut += 4*x + 6;                    // update outer circle desision parameter
+        }
+        else {
+            dOut += 4*(x - yOut) + 10;          // update outer circle desision parameter
+            yOut--;                             // decrement yOut coordinate 
+        }
+        if (x < yIn){                          
+            if (dIn < 0){                       // check inner circle desision parameter
+                dIn += 4*x + 6;                 // update desision parameter
+            }
+            else {
+                dIn += 4*(x - yIn) + 10;        // update inner circle desision parameter
+                yIn--;                          // decrement yIn coordinate
+            }
+        }
+        else yIn++;                             // once yIn = x, keep incrementing yIn so that yIn = x
+        x++;                                    // increment x on each iteration
+    }
+}
+
+//========================================
+// PlotCircle()
+// this function is a helper function for
+// CircleSpans(). It adds the points calculated
+// by the circle algorithms to the spans
+//
+// Parameters:
+//     spans - spans of the circle
+//     x - x-offset for the point (octant 1)
+//     yIn - y-offset for the inner point (octant 1)
+//     yOut - y-offset for the outer point (octant 1)
+//     octants - 8-bit number: xxxx xxxx. Each bit
+//               corresponds to an octant of the circle
+//               and should be set to 1 if that octant
+//               should be plotted (the LSB corresponds
+//               to the fist octant)
+//========================================
+void PlotCircle(oled_spans_t * spans, int x, int yIn, int yOut, uint8 octants){
+    if (octants & 0x01) AddToHalf(spans, spans->right, x, x, yIn, yOut);       // plot octant 0
+    if (octants & 0x02) AddToHalf(spans, spans->right, yIn, yOut, x, x);       // plot octant 1
+    if (octants & 0x04) AddToHalf(spans, spans->left, yIn, yOut, -x, -x);      // plot octant 2
+    if (octants & 0x08) AddToHalf(spans, spans->left, x, x, -yOut, -yIn);      // plot octant 3
+    if (octants & 0x10) AddToHalf(spans, spans->left, -x, -x, -yOut, -yIn);    // plot octant 4
+    if (octants & 0x20) AddToHalf(spans, spans->left, -yOut, -yIn, -x, -x);    // plot octant 5
+    if (octants & 0x40) AddToHalf(spans, spans->right, -yOut, -yIn, x, x);     // plot octant 6
+    if (octants & 0x80) AddToHalf(spans, spans->right, -x, -x, yIn, yOut);     // plot octant 7
+}
+
+//========================================
+// AddToHalf()
+// this function grows the spans of one half
+// of rows y0-y1 of a circle to include 
+// columns x0-x1 (all relative to the center).
+// Rows outside the spans are dropped
+//
+// Parameters:
+//     spans - spans of the circle
+//     half - spans->left or spans->right
+//     y0 - first row
+//     y1 - last row
+//     x0 - first column
+//     x1 - last column
+//========================================
+void AddToHalf(const oled_spans_t * spans, int16 (*half)[2], int y0, int y1, int x0, int x1)
+{
+    if (y0 < spans->top) y0 = spans->top;
+    if (y1 > spans->top + spans->rows - 1) y1 = spans->top + spans->rows - 1;
+    for (int y=y0; y<=y1; y++){
+        int16 * span = half[y - spans->top];
+        if (x0 < span[0]) span[0] = x0;
+        if (x1 > span[1]) span[1] = x1;
+    }
+}
+
+//========================================
+// DrawCircleSpans()
+// this function fills the spans of a circle
+// (or an ellipse) in the foreground color (see
+// RasterOp()). The circle may be stretched
+// into a rounded rectangle: the left halves of
+// the rows are placed relative to column x0
+// and the right halves relative to column x1,
+// the rows above the center relative to row y0
+// and the rows below relative to row y1, with
+// the center row repeated in between. The two
+// halves of a row are filled as one span when
+// they touch. With a sector (circles only) 
+// only the parts of the spans inside it are
+// filled. The columns drawn in on each page 
+// are then passed on to the display (see 
+// UpdatePages())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - column the left halves are relative to
+//     y0 - row the upper rows are relative to
+//     x1 - column the right halves are relative to
+//     y1 - row the lower rows are relative to
+//     spans - spans of the circle
+//     sector - sector to limit the spans to (NULL
+//              for none)
+//========================================
+void DrawCircleSpans(oled_t * oled, int x0, int y0, int x1, int y1, const oled_spans_t * spans, const sector_t * sector)
+{
+    uint8 px0[OLED_HEIGHT/8], px1[OLED_HEIGHT/8];       // columns drawn in on each page (px1 < px0 if none)
+    int s0[2], s1[2], n;                                // spans of a row
+    int lo[2], hi[2], m;                                // parts of the row inside the sector (relative to the center)
+    uint8 op = RasterOp(oled, oled->color);
+    if (op == OLED_KEEP) return;                        // nothing to draw
+
+    memset(px0, OLED_WIDTH - 1, sizeof(px0));
+    memset(px1, 0, sizeof(px1));
+    int top = (y0 + spans->top > oled->clip.y0) ? y0 + spans->top : oled->clip.y0;                         // rows inside the clip rectangle
+    int bottom = (y1 + spans->top + spans->rows - 1 < oled->clip.y1) ? y1 + spans->top + spans->rows - 1 : oled->clip.y1;
+    for (int y=top; y<=bottom; y++){
+        int row = (y < y0) ? y - y0 : (y > y1) ? y - y1 : 0;   // row of the circle
+        int i = row - spans->top;
+        if ((i < 0) || (i >= spans->rows)) continue;    // not computed (off the display)
+        const int16 * l = spans->left[i];
+        const int16 * r = spans->right[i];
+        n = 0;
+        if ((l[0] <= l[1]) && (r[0] <= r[1]) && (r[0] <= l[1] + 1) && (l[0] <= r[1] + 1)){     // halves touch: fill them as one span
+            s0[n] = (x0 + l[0] < x1 + r[0]) ? x0 + l[0] : x1 + r[0];
+            s1[n++] = (x0 + l[1] > x1 + r[1]) ? x0 + l[1] : x1 + r[1];
+        }
+        else {
+            if (l[0] <= l[1]){
+                s0[n] = x0 + l[0];
+                s1[n++] = x0 + l[1];
+            }
+            if (r[0] <= r[1]){
+                s0[n] = x1 + r[0];
+                s1[n++] = x1 + r[1];
+            }
+        }
+        if (sector == NULL){
+            for (int k=0; k<n; k++) FillRow(oled, y, s0[k], s1[k], op, px0, px1);
+            continue;
+        }
+        m = SectorRow(sector, row, lo, hi);
+        for (int k=0; k<n; k++){                                    // fill the parts of each span inside the sector
+            for (int j=0; j<m; j++){
+                int a = (s0[k] > x0 + lo[j]) ? s0[k] : x0 + lo[j];
+                int b = (s1[k] < x0 + hi[j]) ? s1[k] : x0 + hi[j];
+                if (a <= b) FillRow(oled, y, a, b, op, px0, px1);
+            }
+        }
+    }
+    UpdatePages(oled, px0, px1);
+}
+
+//========================================
+// MidpointEllipseAlgorithm()
+// this function uses the midpoint ellipse 
+// algorithm to draw the ring between an inner
+// and an outer ellipse centered at (xc, yc).
+// Like a circle, the ellipse is turned into
+// spans (see EllipseSpans()) that are then
+// filled once each (see DrawCircleSpans()). 
+// Only the rows inside the clip rectangle are
+// computed
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the ellipse
+//     yc - y-coordinate of the center of the ellipse
+//     rxIn - horizontal radius of the inner ellipse
+//     ryIn - vertical radius of the inner ellipse
+//            (either below 0 to fill the ellipse)
+//     rxOut - horizontal radius of the outer ellipse
+//     ryOut - vertical radius of the outer ellipse
+//========================================
+void MidpointEllipseAlgorithm(oled_t * oled, int xc, int yc, int rxIn, int ryIn, int rxOut, int ryOut)
+{
+    if ((rxOut < 0) || (ryOut < 0) || (rxOut > OLED_ELLIPSE_RADIUS) || (ryOut > OLED_ELLIPSE_RADIUS)) return;
+    const oled_clip_t * clip = &oled->clip;
+    xc += clip->ox;                             // display coordinates
+    yc += clip->oy;
+    if ((xc + rxOut < clip->x0) || (xc - rxOut > clip->x1) || (yc + ryOut < clip->y0) || (yc - ryOut > clip->y1)) return;  // outside the clip rectangle
+    oled_spans_t * spans = &circleSpans;
+    
+    int bottom = (ryOut < clip->y1 - yc) ? ryOut : clip->y1 - yc;
+    spans->top = (-ryOut > clip->y0 - yc) ? -ryOut : clip->y0 - yc;     // only the rows inside the clip rectangle
+    if (bottom < spans->top) return;
+    spans->rows = bottom - spans->top + 1;
+    EllipseSpans(spans, rxIn, ryIn, rxOut, ryOut);
+    DrawCircleSpans(oled, xc, yc, xc, yc, spans, NULL);
+}
+
+//========================================
+// EllipseSpans()
+// this function computes the spans of rows
+// spans->top to spans->top + spans->rows - 1
+// (relative to the center) of the ring between
+// an inner and an outer ellipse. Each row 
+// spans from the inside of the inner ellipse's
+// outline (which, like the outer one, is kept
+// connected from row to row) to the outer 
+// ellipse's outline
+//
+// Parameters:
+//     spans - spans of the ellipse (top and rows
+//             set by the caller)
+//     rxIn - horizontal radius of the inner ellipse
+//     ryIn - vertical radius of the inner ellipse
+//            (either below 0 for none)
+//     rxOut - horizontal radius of the outer ellipse
+//     ryOut - vertical radius of the outer ellipse
+//========================================
+void EllipseSpans(oled_spans_t * spans, int rxIn, int ryIn, int rxOut, int ryOut)
+{
+    ellipse_t in, out;                          // inner and outer ellipse
+    int wIn = -1;                               // half width of the inner ellipse on the row before
+    uint8 fill = (rxIn < 0) || (ryIn < 0);      // no inner ellipse
+
+    for (int i=0; i<spans->rows; i++){          // all spans empty
+        spans->left[i][0] = 0x7FFF;
+        spans->left[i][1] = -0x7FFF;
+        spans->right[i][0] = 0x7FFF;
+        spans->right[i][1] = -0x7FFF;
+    }
+    EllipseStart(&out, rxOut, ryOut);
+    if (!fill) EllipseStart(&in, rxIn, ryIn);
+    for (int y=ryOut; y>=0; y--){               // from the top row to the center row
+        int w = EllipseRow(&out);               // half width of the outer ellipse
+        int x = 0;                              // first column of the right half
+        if (!fill && (y <= ryIn)){
+            int wi = EllipseRow(&in);           // half width of the inner ellipse
+            x = (wIn + 1 < wi) ? wIn + 1 : wi;  // keep the inner outline connected
+            if (x > w) x = w;
+            wIn = wi;
+        }
+        AddToHalf(spans, spans->right, -y, -y, x, w);
+        AddToHalf(spans, spans->left, -y, -y, -w, -x);
+        AddToHalf(spans, spans->right, y, y, x, w);
+        AddToHalf(spans, spans->left, y, y, -w, -x);
+    }
+}
+
+//========================================
+// EllipseStart()
+// this function starts the midpoint ellipse
+// algorithm at the top of an ellipse
+//
+// Parameters:
+//     e - pointer to a ellipse_t structure
+//     a - horizontal radius of the ellipse
+//     b - vertical radius of the ellipse
+//========================================
+void EllipseStart(ellipse_t * e, int a, int b)
+{
+    e->a2 = (int32)a*a;
+    e->b2 = (int32)b*b;
+    e->a = a;
+    e->x = 0;                                   // first point is (0, b)
+    e->y = b;
+    e->p = 4*e->b2 - 4*e->a2*b + e->a2;         // initialize decision parameter (midpoint (1, b - 1/2))
+    e->region = 1;
+}
+
+//========================================
+// EllipseRow()
+// this function steps the midpoint ellipse
+// algorithm along the current row (while the
+// slope is under -1 there is more than one
+// point per row) and on to the next row down
+//
+// Parameters:
+//     e - pointer to a ellipse_t structure
+//
+// Returns:
+//     half width of the row (the largest x of
+//     its points)
+//========================================
+int EllipseRow(ellipse_t * e)
+{
+    if (e->y <= 0) return e->a;                 // the center row reaches the radius
+    int y = e->y;
+    int w = 0;
+    
+    while (e->y == y){
+        w = e->x;
+        if ((e->region == 1) && (e->b2*e->x < e->a2*e->y)){    // region 1: step x, and y if the midpoint is outside
+            if (e->p < 0){
+                e->p += 4*e->b2*(2*e->x + 3);
+            }
+            else {
+                e->p += 4*(e->b2*(2*e->x + 3) - 2*e->a2*(e->y - 1));
+                e->y--;
+            }
+            e->x++;
+            continue;
+        }
+        if (e->region == 1){                    // switch to region 2 (midpoint (x + 1/2, y - 1))
+            e->region = 2;
+            e->p = e->b2*(2*e->x + 1)*(2*e->x + 1) - 4*e->a2*(e->b2 - (int32)(e->y - 1)*(e->y - 1));
+        }
+        if (e->p > 0){                          // region 2: step y, and x if the midpoint is inside
+            e->p += 4*e->a2*(3 - 2*e->y);
+        }
+        else {
+            e->p += 4*(e->b2*(2*e->x + 2) + e->a2*(3 - 2*e->y));
+            e->x++;
+        }
+        e->y--;
+    }
+    return w;
+}
+
+//========================================
+// MakeSector()
+// this function sets up the sector from
+// angle a0 to angle a1, in the direction of
+// increasing angles (clockwise on the display,
+// 0 = right, 16384 = down, etc.). The whole
+// circle if a0 == a1
+//
+// Parameters:
+//     sector - sector to set up
+//     a0 - start angle (65536 = one turn)
+//     a1 - end angle (65536 = one turn)
+//========================================
+void MakeSector(sector_t * sector, uint16 a0, uint16 a1)
+{
+    uint16 sweep = a1 - a0;                             // size of the sector (0 = one turn)
+    sector->cos0 = Sine(a0 + 16384);
+    sector->sin0 = Sine(a0);
+    sector->cos1 = Sine(a1 + 16384);
+    sector->sin1 = Sine(a1);
+    sector->wide = (sweep == 0) || (sweep > 32768);
+    if (sweep == 0){                                    // one turn: both half planes take in the whole row
+        sector->cos0 = 0;
+        sector->sin0 = 0;
+    }
+}
+
+//========================================
+// SectorRow()
+// this function finds the parts of row y 
+// (relative to the center) inside a sector.
+// A sector is the part of the plane on the
+// inner side of the lines through the center 
+// along its start and end directions: on both
+// for a sector up to half a turn, on either 
+// for a wider one
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     A - page start address (integer in range 0-7)
-//     B - page end address (integer in range 0-7)
-//======================================
-void SetPageAddress(oled_t * oled, uint8 A, uint8 B)
+//     sector - pointer to a sector_t structure
+//     y - row (relative to the center)
+//     lo - first column of each part (relative
+//          to the center)
+//     hi - last column of each part
+//
+// Returns:
+//     the number of parts (0-2)
+//========================================
+int SectorRow(const sector_t * sector, int y, int * lo, int * hi)
 {
-    if ((A > 7) || (B > 7)) return;                 // check for valid page addresses
-    oled->SendStart(oled->slaveAddr, 0x00);         // generate Start condition and send slave address with R/W# bit = 0 (write mode)
-    oled->WriteByte(0x00);                          // send control byte
-    oled->WriteByte(SSD1306_SETPAGEADDRESS);        // send Set Page Address command
-    oled->WriteByte(A);                             // send page start address
-    oled->WriteByte(B);                             // send page stop address
-    oled->SendStop();                               // generate Stop condition
+    int lo0, hi0, lo1, hi1;
+    HalfPlane(sector->cos0, sector->sin0, y, &lo0, &hi0);     // inner side of the start direction
+    HalfPlane(-sector->cos1, -sector->sin1, y, &lo1, &hi1);   // inner side of the end direction
+    if (sector->wide == 0){                             // both: the overlap
+        lo[0] = (lo0 > lo1) ? lo0 : lo1;
+        hi[0] = (hi0 < hi1) ? hi0 : hi1;
+        return (lo[0] <= hi[0]) ? 1 : 0;
+    }
+    int n = 0;                                          // either: both parts, as one if they touch
+    if (lo0 <= hi0){
+        lo[n] = lo0;
+        hi[n++] = hi0;
+    }
+    if (lo1 <= hi1){
+        if ((n == 1) && (lo1 <= hi0 + 1) && (lo0 <= hi1 + 1)){
+            if (lo1 < lo[0]) lo[0] = lo1;
+            if (hi1 > hi[0]) hi[0] = hi1;
+        }
+        else {
+            lo[n] = lo1;
+            hi[n++] = hi1;
+        }
+    }
+    return n;
 }
 
-//======================================
-// SetColumnAddress()
-// this function sets the oled's column start 
-// address and column stop address
+//========================================
+// HalfPlane()
+// this function finds the part of row y
+// (relative to the center) on the clockwise
+// side of the line through the center along
+// direction (ux, uy), i.e. the points p for
+// which ux*p.y - uy*p.x >= 0
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     A: column start address (integer in range 0-127)
-//     B: column end address (integer in range 0-127)
-//======================================
-void SetColumnAddress(oled_t * oled, uint8 A, uint8 B)
+//     ux - x-component of the direction
+//     uy - y-component of the direction
+//     y - row (relative to the center)
+//     lo - first column of the part
+//     hi - last column of the part (hi < lo if
+//          the part is empty)
+//========================================
+void HalfPlane(int ux, int uy, int y, int * lo, int * hi)
 {
-    if ((A > 127) || (B > 127)) return;             // check for valid column addresses
-    oled->SendStart(oled->slaveAddr, 0x00);         // generate Start condition and send slave address with R/W# bit = 0 (write mode)
-    oled->WriteByte(0x00);                          // send control byte
-    oled->WriteByte(SSD1306_SETCOLUMNADDRESS);      // send Set Column Address command
-    oled->WriteByte(A);                             // send column start address
-    oled->WriteByte(B);                             // send column stop address
-    oled->SendStop();                               // generate Stop condition
+    *lo = -0x7FFF;                                      // whole row
+    *hi = 0x7FFF;
+    if (uy > 0) *hi = FloorDiv(ux*y, uy);               // columns up to ux*y/uy
+    else if (uy < 0) *lo = -FloorDiv(ux*y, -uy);        // columns from ux*y/uy
+    else if (ux*y < 0){                                 // row on the other side of a horizontal line: empty
+        *lo = 0x7FFF;
+        *hi = -0x7FFF;
+    }
 }
 
-//======================================
-// WriteGRAM()
-// this functions writes the specified color to
-// the rectangular block of GRAM defined by
-// its upper left corner (x0, y0) and lower right
-// corner (x1, y1)
+//========================================
+// ScanPolygon()
+// this function fills, or outlines, the 
+// polygon with the n corners given by points
+// one row at a time. Each row is drawn as a
+// few spans (see PolygonRow()), each with a
+// single GRAM operation, so no pixel is drawn
+// twice
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     x0 - upper left x-coordinate
-//     y0 - upper left y-coordinate
-//     x1 - lower right x-coordinate
-//     y1 - lower right y-coordinate
-//======================================
-void WriteGRAM(oled_t * oled, int x0, int y0, int x1, int y1, uint8 color)
+//     points - pointer to an array of n (x, y)
+//              pairs
+//     n - number of corners (1 to 
+//         OLED_POLYGON_POINTS)
+//     fill - 1 to fill the polygon, 0 to draw
+//            only its outline (pen size 0)
+//========================================
+void ScanPolygon(oled_t * oled, const int16 * points, int n, uint8 fill)
 {
-    if (x0 < 0) x0 = 0;                                 // ensure x0, y0, x1, y1 are within display bounds
-    if (x1 > OLED_WIDTH - 1) x1 = OLED_WIDTH - 1;
-    if (x1 < x0) return;                                                
-    if (y0 < 0) y0 = 0;
-    if (y1 > OLED_HEIGHT - 1) y1 = OLED_HEIGHT - 1;
-    if (y1 < y0) return;
-    
-    SetPageAddress(oled, y0/8, y1/8);                   // set the start page address and stop page address
-    SetColumnAddress(oled, x0, x1);                     // set the start column address and stop column address
-    
-    oled->SendStart(oled->slaveAddr, 0x00);             // generate Start condition and send slave address with R/W# bit = 0 (write mode)
-    oled->WriteByte(0x40);                              // send "GRAM write" control byte
-    
-    uint8 mask;
-    for (int i=y0/8; i<=y1/8; i++){                     // iterate over pages that will be modified
-        mask = 0x00;                                    // create a bit mask to preserve pixels that are outside the defined rectangle
-        if (i == y0/8){                                               
-            mask = 0xFF >> (8 - y0%8);
-        }
-        if (i == y1/8){
-            mask = mask | (0xFF << (1 + y1%8));
-        }
-        for (int j=x0; j<=x1; j++){                                                             // iterate over columns
-            if (color == 0){
-                oled->GRAM[i*OLED_WIDTH + j] = oled->GRAM[i*OLED_WIDTH + j] & mask;             // update the byte in GRAM
-            }
-            else {
-                oled->GRAM[i*OLED_WIDTH + j] = ~mask | (oled->GRAM[i*OLED_WIDTH + j] & mask);   // update the byte in GRAM
-            }
-        oled->WriteByte(oled->GRAM[i*OLED_WIDTH + j]);                                          // write byte to the display
+    if ((n < 1) || (n > OLED_POLYGON_POINTS)) return;
+    uint8 op = RasterOp(oled, oled->color);
+    if (op == OLED_KEEP) return;                        // nothing to draw
+
+    edge_t * edges = polygonEdges;                      // edge table, sorted by top row
+    uint8 * active = polygonActive;                     // edges crossing the current row
+    int16 (*spans)[2] = polygonSpans;                   // spans of the current row
+    uint8 x0[OLED_HEIGHT/8], x1[OLED_HEIGHT/8];         // columns drawn in on each page (x1 < x0 if none)
+    const oled_clip_t * clip = &oled->clip;
+    int left = 0x7FFF, right = -0x7FFF, bottom = -0x7FFF;
+
+    EdgeTable(oled, points, n, edges);
+    for (int i=0; i<n; i++){                            // bounding box
+        if (edges[i].x0 < left) left = edges[i].x0;
+        if (edges[i].x1 < left) left = edges[i].x1;
+        if (edges[i].x0 > right) right = edges[i].x0;
+        if (edges[i].x1 > right) right = edges[i].x1;
+        if (edges[i].y1 > bottom) bottom = edges[i].y1;
+    }
+    if ((right < clip->x0) || (left > clip->x1) || (bottom < clip->y0) || (edges[0].y0 > clip->y1)) return;  // outside the clip rectangle
+
+    memset(x0, OLED_WIDTH - 1, sizeof(x0));
+    memset(x1, 0, sizeof(x1));
+    int next = 0, m = 0;                                // next edge of the table to become active, active edges
+    int y = (edges[0].y0 > clip->y0) ? edges[0].y0 : clip->y0;
+    if (bottom > clip->y1) bottom = clip->y1;
+    for (; y<=bottom; y++){                             // rows inside the clip rectangle
+        while ((next < n) && (edges[next].y0 <= y)) active[m++] = next++;
+        int k = 0;
+        for (int i=0; i<m; i++){                        // drop the edges above the row
+            if (edges[active[i]].y1 >= y) active[k++] = active[i];
         }
+        m = k;
+        int count = PolygonRow(edges, active, m, y, fill, spans);
+        for (int i=0; i<count; i++) FillRow(oled, y, spans[i][0], spans[i][1], op, x0, x1);
     }
-    
-    oled->SendStop();                                   // generate Stop condition
+    UpdatePages(oled, x0, x1);
 }
 
 //========================================
-// DrawHLine()
-// this functions draws a horizontal line
-// between the points (x0, y) and (x1, y)
+// EdgeTable()
+// this function builds the edge table of a
+// polygon: its edges in display coordinates,
+// each from its top end to its bottom end, 
+// sorted by top row
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     y - y-coordinate of line
-//     x0 - x-coordinate of the first point
-//     x1 - x-coordinate of the second point
+//     points - pointer to an array of n (x, y)
+//              pairs
+//     n - number of corners (and edges)
+//     edges - the edge table
 //========================================
-void DrawHLine(oled_t * oled, int y, int x0, int x1)
+void EdgeTable(oled_t * oled, const int16 * points, int n, edge_t * edges)
 {
-    if (x0 <= x1) WriteGRAM(oled, x0-oled->penSize, y-oled->penSize, x1+oled->penSize, y+oled->penSize, oled->color);   // draw horizontal line (x0 <= x1)
-    else WriteGRAM(oled, x1-oled->penSize, y-oled->penSize, x0+oled->penSize, y+oled->penSize, oled->color);            // draw horizontal line (x0 > x1)
+    for (int i=0; i<n; i++){
+        int j = (i + 1 < n) ? i + 1 : 0;                // the last edge closes the polygon
+        edge_t e = {points[2*i] + oled->clip.ox, points[2*i + 1] + oled->clip.oy, points[2*j] + oled->clip.ox, points[2*j + 1] + oled->clip.oy};
+        if (e.y1 < e.y0){                               // top end first
+            e.x0 = points[2*j] + oled->clip.ox;
+            e.y0 = points[2*j + 1] + oled->clip.oy;
+            e.x1 = points[2*i] + oled->clip.ox;
+            e.y1 = points[2*i + 1] + oled->clip.oy;
+        }
+        int k = i;                                      // insert it in order
+        for (; (k > 0) && (edges[k - 1].y0 > e.y0); k--) edges[k] = edges[k - 1];
+        edges[k] = e;
+    }
 }
 
 //========================================
-// DrawVLine()
-// this functions draws a vertical line
-// between the points (x, y0) and (x, y1)
+// PolygonRow()
+// this function finds the spans of row y of
+// a polygon: the parts between pairs of its
+// edges (even-odd rule) and the parts its
+// edges cover, merged into as few spans as 
+// possible and sorted from left to right.
+// For an outline only the pixels of the 
+// edges themselves are taken (see EdgeRun())
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     x - x-coordinate of line
-//     y0 - y-coordinate of the first point
-//     y1 - y-coordinate of the second point
+//     edges - edge table of the polygon
+//     active - edges crossing the row
+//     m - number of edges crossing the row
+//     y - row
+//     fill - 1 to fill the polygon, 0 for its
+//            outline
+//     spans - first and last column of each span
+//
+// Returns:
+//     the number of spans
 //========================================
-void DrawVLine(oled_t * oled, int x, int y0, int y1)
+int PolygonRow(const edge_t * edges, const uint8 * active, int m, int y, uint8 fill, int16 (*spans)[2])
 {
-    if (y0 <= y1) WriteGRAM(oled, x-oled->penSize, y0-oled->penSize, x+oled->penSize, y1+oled->penSize, oled->color);   // draw vertical line (y0 <= y1)
-    else WriteGRAM(oled, x-oled->penSize, y1-oled->penSize, x+oled->penSize, y0+oled->penSize, oled->color);            // draw vertical line (y0 > y1)
+    int16 * cross = polygonCross;                       // columns at which the edges cross the middle of the row
+    int c = 0, n = 0;
+
+    for (int i=0; i<m; i++){
+        const edge_t * e = &edges[active[i]];
+        if (fill && (e->y0 <= y) && (y < e->y1)){       // crosses the middle of the row (bottom ends are left out, so a corner is crossed once)
+            int x = EdgeX(e, 2*y), k = c++;
+            for (; (k > 0) && (cross[k - 1] > x); k--) cross[k] = cross[k - 1];
+            cross[k] = x;
+        }
+        int a = EdgeColumn(e->x0), b = EdgeColumn(e->x1);  // columns the edge covers in the row (all of them if it is horizontal)
+        if (!fill){                                     // the edge's own pixels
+            EdgeRun(e, y, &a, &b);
+            if (b < a) continue;
+        }
+        else if (e->y0 < e->y1){
+            a = EdgeX(e, (2*y - 1 > 2*e->y0) ? 2*y - 1 : 2*e->y0);     // from the top of the row (or the top end)...
+            b = EdgeX(e, (2*y + 1 < 2*e->y1) ? 2*y + 1 : 2*e->y1);     // ...to the bottom of the row (or the bottom end), in half rows
+        }
+        spans[n][0] = (a < b) ? a : b;
+        spans[n++][1] = (a < b) ? b : a;
+    }
+    for (int i=0; i+1<c; i+=2){                         // inside: between pairs of crossings
+        spans[n][0] = cross[i];
+        spans[n++][1] = cross[i + 1];
+    }
+
+    for (int i=1; i<n; i++){                            // sort by first column
+        int16 s0 = spans[i][0], s1 = spans[i][1];
+        int k = i;
+        for (; (k > 0) && (spans[k - 1][0] > s0); k--){
+            spans[k][0] = spans[k - 1][0];
+            spans[k][1] = spans[k - 1][1];
+        }
+        spans[k][0] = s0;
+        spans[k][1] = s1;
+    }
+    int count = 0;
+    for (int i=0; i<n; i++){                            // merge the spans that touch
+        if ((count > 0) && (spans[i][0] <= spans[count - 1][1] + 1)){
+            if (spans[i][1] > spans[count - 1][1]) spans[count - 1][1] = spans[i][1];
+            continue;
+        }
+        spans[count][0] = spans[i][0];
+        spans[count++][1] = spans[i][1];
+    }
+    return count;
 }
 
 //========================================
-// BresenhamLineAlgorithm()
-// this function uses Bresenham's line algorithm to
-// draw a line between the points (x0, y0) and 
-// (x0+dx, y0+dy). Bresenham's algorithm requires
-// the slope of the line to be between 0 and 1, however
-// the parameter rot allows the caller to specify 
-// whether the line should be rotated when plotted 
-// on the display
+// EdgeRun()
+// this function finds the pixels of a 
+// polygon edge on row y, as a line would 
+// draw it: one per row if the edge is steep,
+// otherwise the columns whose point on the 
+// edge rounds to the row. Consecutive rows 
+// do not overlap
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     x0 - x-coordinate of the start of the line
-//     y0 - y-coordinate of the start of the line
-//     dx - length of the line in the x-direction
-//     dy - length of the line in the y-direction
-//     rot - desired rotation (integer in range 0-3)
+//     e - pointer to the edge
+//     y - row (from e->y0 to e->y1)
+//     a - receives the first column
+//     b - receives the last column (b < a if
+//         there is none)
 //========================================
-void BresenhamLineAlgorithm(oled_t * oled, int x0, int y0, int dx, int dy, uint8 rot)
+void EdgeRun(const edge_t * e, int y, int * a, int * b)
 {
-    if ((dx < 0) || (dy < 0) || (dy > dx)) return;              // make sure the slope is between 0 and 1
-    
-    int error = 0;                                              // initialize error to 0 
-    int x = 0, y = 0;                                           // set x and y to 0 (start algorithm at the origin)
-    int thresh = dx - 2*dy;                                     // decision threshold (increase y if error becomes greater than thresh)
-    uint8 step = 0;                                             // this variable keeps track of whether y was incrementd on the previous itteration (1 if y was incremented, 0 otherwise)
-    
-    for(; x<=dx; x++){                                          // iterate over  x coordinates
-        if ((x == 0) && (-2*dy + 2*dx > thresh)) step = 1;      // set step = 1 if a step would have been made right before the begining of the line
-        PlotPerpLineL(oled, x0, y0, dx, dy, x, y, step, rot);
-        PlotPerpLineR(oled, x0, y0, dx, dy, x, y, step, rot);
-        if (error > thresh){                                    // check decision threshold
-            y++;                                                // increment the y coordinate
-            error += 2*dy - 2*dx;                               // update the error
-            step = 1;                                           // step was made, so set step to 1
-        }
-        else {
-            error += 2*dy;                                      // update the error
-            step = 0;                                           // step was not made, so set step to 0
-        }
+    int32 dx = e->x1 - e->x0;
+    int32 dy = e->y1 - e->y0;
+    int64 lo = (dx < 0) ? e->x1 : e->x0;                // columns of the edge
+    int64 hi = (dx < 0) ? e->x0 : e->x1;
+    int64 first = lo, last = hi;                        // all of them if it is horizontal
+
+    if ((dy > 0) && (dx <= dy) && (-dx <= dy)){         // steep: the column at the middle of the row
+        first = EdgeAt(e, 2*y, 1);
+        last = first;
+    }
+    else if ((dy > 0) && (dx > 0)){                     // shallow, going right: from the top of the row to just before its bottom, in half rows
+        first = EdgeAt(e, 2*y - 1, 2);
+        last = EdgeAt(e, 2*y + 1, 2) - 1;
     }
+    else if (dy > 0){                                   // shallow, going left
+        first = EdgeAt(e, 2*y + 1, 0) + 1;
+        last = EdgeAt(e, 2*y - 1, 0);
+    }
+    *a = EdgeColumn((first < lo) ? lo : first);         // not beyond the ends of the edge
+    *b = EdgeColumn((last > hi) ? hi : last);
 }
 
 //========================================
-// PlotPerpLineL()
-// this function is a helper function for 
-// BresenhamLineAlgorithm(). It uses a modified 
-// version of Bresenham's line algorithm to add
-// thickness to the line being drawn in BresenhamLineAlgorithm().
-// It does this by plotting a perpendicular line
-// to the left side of the line being drawn. The 
-// starting point for this perpendicular line is
-// the point (x0+x, y0+y)
+// EdgeX()
+// this function returns the column of a 
+// polygon edge at a given row, rounded to 
+// the nearest pixel and kept just off the
+// display if it is off it
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     x0 - x-coordinate of the start of the line
-//     y0 - y-coordinate of the start of the line
-//     dx - length of the line in the x-direction
-//     dy - length of the line in the y-direction
-//     x - x-coordinate offset for the starting point
-//         of the perpendicular line
-//     y - y-coordinate offset for the starting point
-//         of the perpendicular line
-//     step - binary value which indicates if the y 
-//            offset was increment in the previous
-//            iteration of Bresenham's algorithm     
-//     rot - desired rotation (integer in range 0-3)
+//     e - pointer to the edge (not horizontal)
+//     t - row, in half rows (2*y is the middle
+//         of row y)
 //
-// Note: the "line" refered to in the parameter descriptions
-// is used in reference to the line being drawn in
-// BresenhamLineAlgorithm() unless stated otherwise
+// Returns:
+//     the column of the edge at row t/2
 //========================================
-void PlotPerpLineL(oled_t * oled, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot)
+int EdgeX(const edge_t * e, int t)
 {
-    int error = 0;
-    int thresh = dx - 2*dy;             // decision threshold (decrease x if error becomes greater than thresh)
-    
-    for (int i=0; i<oled->penSize+1; i++){
-        PlotPoint(oled, x0, y0, x, y, rot); // plot pixel
-        if (error > thresh){            // check decision threshold
-            x--;                        // decrement the x coordinate
-            error += 2*dy - 2*dx;       // update the error
-            if ((step == 1) && (i != oled->penSize)){
-                PlotPoint(oled, x0, y0, x, y, rot);      // fill in "gap" pixel      
-            }
-        }
-        else {
-            error += 2*dy;              // update the error   
-        }
-        y++;                            // increment y on every itteratioon
-    }
+    return EdgeColumn(EdgeAt(e, t, 1));
 }
 
 //========================================
-// PlotPerpLineR()
-// this function is a helper function for 
-// BresenhamLineAlgorithm(). It uses a modified 
-// version of Bresenham's line algorithm to add
-// thickness to the line being drawn in BresenhamLineAlgorithm().
-// It does this by plotting a perpendicular line
-// to the right side of the line being drawn. The 
-// starting point for this perpendicular line is
-// the point (x0+x, y0+y)
+// EdgeAt()
+// this function returns the column of a 
+// polygon edge at a given row. Edges far off
+// the display, whose products do not fit in
+// 32 bits, are worked out in 64 bits
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     x0 - x-coordinate of the start of the line
-//     y0 - y-coordinate of the start of the line
-//     dx - length of the line in the x-direction
-//     dy - length of the line in the y-direction
-//     x - x-coordinate offset for the starting point
-//         of the perpendicular line
-//     y - y-coordinate offset for the starting point
-//         of the perpendicular line
-//     step - binary value which indicates if the y 
-//            offset was increment in the previous
-//            iteration of Bresenham's algorithm     
-//     rot - desired rotation (integer in range 0-3)
+//     e - pointer to the edge (not horizontal)
+//     t - row, in half rows (2*y is the middle
+//         of row y), within a row of the edge
+//     round - 0 to round down, 1 to the nearest
+//             column, 2 up
 //
-// Note: the "line" refered to in the parameter descriptions
-// is used in reference to the line being drawn in
-// BresenhamLineAlgorithm() unless stated otherwise
+// Returns:
+//     the column of the edge at row t/2
 //========================================
-void PlotPerpLineR(oled_t * oled, int x0, int y0, int dx, int dy, int x, int y, int step, uint8 rot)
+int64 EdgeAt(const edge_t * e, int t, uint8 round)
 {
-    int error = 0;
-    int thresh = dx - 2*dy;             // decision threshold (increase x if error becomes greater than thresh)
-    
-    for (int i=0; i<oled->penSize+1; i++){
-        if (i != 0) PlotPoint(oled, x0, y0, x, y, rot);     // plot pixel (don't plot the first pixel. This will have already been plotted by PlotPerpLineL()
-        if (error > thresh){            // check decision threshold
-            x++;                        // increment the x coordinate
-            error += 2*dy - 2*dx;       // update the error
-            if ((step == 1) && (i != oled->penSize)){
-                PlotPoint(oled, x0, y0, x-1, y-1, rot);             // fill in "gap" pixel    
-            }
-        }
-        else {
-            error += 2*dy;              // update the error   
-        }
-        y--;                            // decrement y on every itteratioon
+    int32 dy = 2*(e->y1 - e->y0);                       // in half rows
+    int32 dx = e->x1 - e->x0;
+    int32 bias = (round == 0) ? 0 : (round == 1) ? dy : 2*dy - 1;
+
+    if ((dy < 0x8000) && (dx > -0x4000) && (dx < 0x4000)){
+        return e->x0 + FloorDiv(2*(t - 2*e->y0)*dx + bias, 2*dy);
     }
+    int64 a = 2*(int64)(t - 2*e->y0)*dx + bias;
+    return e->x0 + ((a >= 0) ? a/(2*dy) : -((-a + 2*dy - 1)/(2*dy)));    // rounded down
 }
 
 //========================================
-// PlotPoint()
-// this function is a helper function for 
-// PlotPerpLineL()/PlotPerpLineR(). It plots
-// the points calculated by the line algorithms
-// with the specified rotation (i.e the 
-// transformation necesssary to draw lines
-// with slopes less than 0 or greater than 1)
+// EdgeColumn()
+// this function keeps a column of a polygon
+// edge just off the display if it is off it,
+// so that it fits in a 16-bit span
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     x0 - x-coordinate of the start of the line
-//     y0 - y-coordinate of the start of the line
-//     x - x-coordinate offset for the starting point
-//         of the perpendicular line
-//     y - y-coordinate offset for the starting point
-//         of the perpendicular line    
-//     rot - desired rotation (integer in range 0-3)
+//     x - column (display coordinates)
 //
-// Note: the "line" refered to in the parameter descriptions
-// is used in reference to the line being drawn in
-// BresenhamLineAlgorithm() unless stated otherwise
+// Returns:
+//     x, limited to -1 to OLED_WIDTH
 //========================================
-void PlotPoint(oled_t * oled, int x0, int y0, int x, int y, uint8 rot)
+int EdgeColumn(int64 x)
 {
-    if (rot == 0) oled_DrawPixel(oled, y0+y, x0+x);            // slope > 1
-    else if (rot == 1) oled_DrawPixel(oled, x0+x, y0+y);       // 0 <= slope <= 1
-    else if (rot == 2) oled_DrawPixel(oled, x0+x, -y0-y);      // -1 <= slope < 0
-    else if (rot == 3) oled_DrawPixel(oled, y0+y, -x0-x);      // slope < -1
+    if (x < -1) return -1;
+    if (x > OLED_WIDTH) return OLED_WIDTH;
+    return x;
 }
 
 //========================================
-// BresenhamCircleAlgorithm()
-// this function uses Bresenham's circle algorithm to
-// draw a circle of radius r centered at (xc, yc). 
+// Sine()
+// this function returns the sine of a binary 
+// angle, interpolated from sineTable
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     xc - x-coordinate of the center of the circle
-//     yc - y-coordinate of the center of the circle
-//     rIn - radius of circle
-//     rOut - outer radius of circle
-//     octants - 8-bit number: xxxx xxxx. Each bit
-//               corresponds to an octant of the circle
-//               and should be set to 1 if that octant
-//               should be plotted (the LSB corresponds
-//               to the octant 0)
+//     a - angle (65536 = one turn)
+//
+// Returns:
+//     the sine (16384 = 1.0)
 //========================================
-void BresenhamCircleAlgorithm(oled_t *oled, int xc, int yc, int rIn, int rOut, uint8 octants)
+int Sine(uint16 a)
 {
-    if ((rIn > rOut) || (rOut == 0)) return;    // inner radius must be less than or equal to the outer radius
-    int dIn = 3 - 2*rIn;                        // initialize decision parameter for inner circle
-    int dOut = 3 - 2*rOut;                      // initialize decision parameter for inner circle
-    int x = 0, yIn = rIn, yOut = rOut;          // initialize first point on the inner cicle to (0, rIn) and first point on the outer cicle to (0, rOut)
-
-    while (yIn <= yOut){                        // itterate over x until x becomes larger than yIn
-        PlotCircle(oled, xc, yc, x, yIn, yOut, octants);
-        if (dOut < 0){                          // check outer circle desision parameter
-            dOut += 4*x + 6;                    // update outer circle desision parameter
-        }
-        else {
-            dOut += 4*(x - yOut) + 10;          // update outer circle desision parameter
-            yOut--;                             // decrement yOut coordinate 
-        }
-        if (x < yIn){                          
-            if (dIn < 0){                       // check inner circle desision parameter
-                dIn += 4*x + 6;                 // update desision parameter
-            }
-            else {
-                dIn += 4*(x - yIn) + 10;        // update inner circle desision parameter
-                yIn--;                          // decrement yIn coordinate
-            }
-        }
-        else yIn++;                             // once yIn = x, keep incrementing yIn so that yIn = x
-        x++;                                    // increment x on each iteration
+    int i = (a >> 8) & 0x3F;                            // step within the quarter turn
+    int f = a & 0xFF;                                   // fraction of the step
+    int s;
+    if (a & 0x4000){                                    // second and fourth quarter: mirrored
+        i = 64 - i;
+        s = sineTable[i] + (((sineTable[i - 1] - sineTable[i])*f) >> 8);
     }
+    else s = sineTable[i] + (((sineTable[i + 1] - sineTable[i])*f) >> 8);
+    return (a & 0x8000) ? -s : s;                       // second half turn: negative
 }
 
 //========================================
-// PlotCircle()
-// this function is a helper function for
-// BresenhamCircleAlgorithm(). It plots
-// the points calculated by the circle algorithms
+// FloorDiv()
+// this function divides a by b, rounding
+// down (C division rounds towards 0)
 //
 // Parameters:
-//     oled - pointer to a oled_t structure
-//     xc - x-coordinate of the center of the circle
-//     yc - y-coordinate of the center of the circle
-//     x - x-offset for the point (octant 1)
-//     yIn - y-offset for the inner point (octant 1)
-//     yOut - y-offset for the outer point (octant 1)
-//     octants - 8-bit number: xxxx xxxx. Each bit
-//               corresponds to an octant of the circle
-//               and should be set to 1 if that octant
-//               should be plotted (the LSB corresponds
-//               to the fist octant)
+//     a - dividend
+//     b - divisor (greater than 0)
+//
+// Returns:
+//     the largest integer not greater than a/b
 //========================================
-void PlotCircle(oled_t * oled, int xc, int yc, int x, int yIn, int yOut, uint8 octants){
-    if (octants & 0x01) WriteGRAM(oled, xc+yIn, yc+x, xc+yOut, yc+x, oled->color);    // plot octant 0
-    if (octants & 0x02) WriteGRAM(oled, xc+x, yc+yIn, xc+x, yc+yOut, oled->color);    // plot octant 1
-    if (octants & 0x04) WriteGRAM(oled, xc-x, yc+yIn, xc-x, yc+yOut, oled->color);    // plot octant 2
-    if (octants & 0x08) WriteGRAM(oled, xc-yOut, yc+x, xc-yIn, yc+x, oled->color);    // plot octant 3
-    if (octants & 0x10) WriteGRAM(oled, xc-yOut, yc-x, xc-yIn, yc-x, oled->color);    // plot octant 4
-    if (octants & 0x20) WriteGRAM(oled, xc-x, yc-yOut, xc-x, yc-yIn, oled->color);    // plot octant 5
-    if (octants & 0x40) WriteGRAM(oled, xc+x, yc-yOut, xc+x, yc-yIn, oled->color);    // plot octant 6
-    if (octants & 0x80) WriteGRAM(oled, xc+yIn, yc-x, xc+yOut, yc-x, oled->color);    // plot octant 7
+int FloorDiv(int a, int b)
+{
+    if (a >= 0) return a/b;
+    return -((-a + b - 1)/b);
 }
 
 //========================================
@@ -6,6 +6,7 @@
 //======================================
 #include "project.h"
 #include "font.h"
+#include "oled_transport.h"
 
 //======================================
 // oled dimensions                              
@@ -27,7 +28,78 @@
 // text modes                          
 //======================================
 #define OLED_TEXT_TRAN OLED_BM_WHITE_TRAN   // characters are displayed in the forground color, background is transparent
-#define OLED_TEXT_FILL OLED_BM_WHITE_TRAN   // characters are displayed in the forground color, background is filled with the background color  
+#define OLED_TEXT_FILL OLED_BM_WHITE_FILL   // characters are displayed in the forground color, background is filled with the background color  
+
+//======================================
+// compressed (RLE) bitmaps and fonts
+//======================================
+#define OLED_RLE_REPEAT 0x80    // control byte bit: the packet is one byte repeated (c & 0x7F)+2 times, otherwise c+1 bytes follow
+
+//======================================
+// GRAM operations
+//======================================
+#define OLED_INVERT 2           // invert pixels instead of drawing them in a color (see oled_InvertRect())
+#define OLED_KEEP 3             // leave pixels as they are (see oled_SetRasterOp())
+
+//======================================
+// raster operations (see oled_SetRasterOp())
+//======================================
+#define OLED_ROP_COPY 0         // pixels drawn are set to the color they are drawn in
+#define OLED_ROP_OR 1           // pixels drawn in white are turned on, pixels drawn in black are left as they are
+#define OLED_ROP_AND_NOT 2      // pixels drawn in white are turned off, pixels drawn in black are left as they are
+#define OLED_ROP_XOR 3          // pixels drawn in white are inverted, pixels drawn in black are left as they are
+
+//======================================
+// update modes                          
+//======================================
+#define OLED_UPDATE_IMMEDIATE 0     // drawing functions send their changes to the display as soon as GRAM is modified
+#define OLED_UPDATE_DEFERRED 1      // drawing functions only modify GRAM, changes are sent to the display by oled_Flush()/oled_FlushRect()
+
+//======================================
+// angles (see oled_DrawArcAngle())
+//======================================
+#define OLED_DEGREES(d) ((uint16)((((int32)(d) % 360)*65536)/360))  // angle in degrees (any number of turns) to an angle in 65536ths of a turn
+
+//======================================
+// circle spans (see oled_SetSpanCache())
+//======================================
+#define OLED_SPAN_CACHE_RADIUS (OLED_HEIGHT/2 - 1)  // largest outer radius of a cached circle (one that fits on the display)
+
+typedef struct {
+    int16 top;                  // row of the first span, relative to the center of the circle
+    uint8 rows;                 // number of rows
+    int16 left[OLED_HEIGHT][2]; // first and last column of the left half of each row, relative to the center (last < first if the half is empty)
+    int16 right[OLED_HEIGHT][2];    // first and last column of the right half of each row
+} oled_spans_t;
+
+typedef struct {
+    int16 rIn;                  // inner radius of the circle the spans are for
+    uint8 rOut;                 // outer radius (0 if the entry is empty)
+    uint8 octants;              // octants drawn
+    uint8 age;                  // circles drawn since the entry was last used
+    oled_spans_t spans;         // spans of the whole circle
+} oled_span_cache_t;
+
+//======================================
+// ellipses (see oled_DrawEllipse())
+//======================================
+#define OLED_ELLIPSE_RADIUS 127 // largest outer radius of an ellipse (keeps its arithmetic in 32 bits)
+
+//======================================
+// polygons (see oled_FillPolygon())
+//======================================
+#define OLED_POLYGON_POINTS 16  // most corners of a filled polygon
+
+//======================================
+// clipping (see oled_PushClip())
+//======================================
+#define OLED_CLIP_DEPTH 4       // viewports oled_PushClip() can save
+
+typedef struct {
+    int16 x0, y0;               // upper left corner of the clip rectangle (display coordinates)
+    int16 x1, y1;               // lower right corner (x1 < x0 or y1 < y0 if nothing can be drawn)
+    int16 ox, oy;               // origin: the point of the display that drawing functions call (0, 0)
+} oled_clip_t;
 
 //======================================
 // ssd1306 commands                               
@@ -40,21 +112,45 @@
 #define SSD1306_SETCOLUMNADDRESS 0x21       // Set Column Address
 #define SSD1306_SETPAGEADDRESS 0x22         // Set Page Address
 
+//======================================
+// GRAM                          
+//======================================
+#define OLED_GRAM_SIZE (OLED_WIDTH*(OLED_HEIGHT/8))         // size of GRAM (in bytes)
+#define OLED_WINDOW_CMDS_SIZE 6                             // bytes needed to open a window: Set Page Address and Set Column Address, each with two parameters
+
 //======================================
 // oled struct                                 
 //======================================
-typedef struct {
-    uint8 slaveAddr;                                    // oled I2C address
-    uint8 (*SendStart)(uint8 slaveAddr, uint8 R_nW);    // function pointer to I2C_MasterSendStart(). Generates an I2C Start condition and sends the slave address with the read/write bit
-    uint8 (*SendStop)(void);                            // function pointer to I2C_MasterSendStop(). Generates and I2C Stop condition
-    uint8 (*WriteByte)(uint8 byte);                     // function pointer to I2C_MasterWriteByte(). Send one byte via I2C
+typedef struct oled_s {
+    oled_transport_t * transport;                       // transport used to send commands and GRAM data to the display
+    void (*OnComplete)(struct oled_s * oled);           // called once all queued transfers have completed (NULL if not used)
     uint8 bkColor;                                      // background color
     uint8 color;                                        // foreground color 
     uint8 penSize;                                      // pen size for drawing functions
     const font_t * font;                                // text font
     uint8 bmMode;                                       // bitmap mode
     uint8 textMode;                                     // text mode (i.e. transparent, fill)
-    uint8 GRAM[OLED_WIDTH*(OLED_HEIGHT/8)];             // "internal copy" of oled graphic RAM (GRAM)  
+    uint8 rop;                                          // raster operation (i.e. copy, or, and-not, xor)
+    uint8 updateMode;                                   // update mode (i.e. immediate, deferred)
+    uint8 dirtyX0[OLED_HEIGHT/8];                       // left column of the part of each page not yet sent to the display
+    uint8 dirtyX1[OLED_HEIGHT/8];                       // right column of the part of each page not yet sent to the display (dirtyX1 < dirtyX0 if the page is clean)
+    uint8 * shadow;                                     // copy of what the display's GRAM actually holds (NULL if not used)
+    uint8 shadowValid;                                  // 1 once the shadow copy matches the display
+    uint8 queueX0[OLED_HEIGHT/8];                       // left column of the part of each page queued for a background transfer
+    uint8 queueX1[OLED_HEIGHT/8];                       // right column of the part of each page queued for a background transfer (queueX1 < queueX0 if nothing is queued)
+    uint8 queuePage;                                    // page the search for the next queued transfer starts at
+    uint16 txFrame;                                     // offset in GRAM of the next byte of a full frame transfer (OLED_GRAM_SIZE if no frame is being transferred)
+    uint8 txDone;                                       // 1 if OnComplete() is owed for transfers that have finished
+    uint8 prevX0[OLED_HEIGHT/8];                        // dirty columns of each page in the previously presented frame (double buffering only)
+    uint8 prevX1[OLED_HEIGHT/8];
+    oled_span_cache_t * spanCache;                      // spans of recently drawn circles (NULL if not used)
+    uint8 spanCacheSize;                                // number of entries in spanCache
+    oled_clip_t clip;                                   // clip rectangle and origin of drawing functions
+    oled_clip_t clipStack[OLED_CLIP_DEPTH];             // viewports saved by oled_PushClip()
+    uint8 clipDepth;                                    // number of viewports saved
+    uint8 * GRAM;                                       // "internal copy" of oled graphic RAM (GRAM) that drawing functions modify
+    uint8 * txGRAM;                                     // copy of GRAM that transfers to the display read from (same as GRAM unless double buffered)
+    uint8 buffer[OLED_GRAM_SIZE];                       // built-in GRAM buffer
 } oled_t;
 
 //======================================
@@ -65,12 +161,163 @@ typedef struct {
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     slaveAddr - 7-bit I2C address
-//     SendStart - function pointer to I2C_MasterSendStart()
-//     SendStop - function pointer to I2C_MasterSendStop()
-//     WriteByte - function pointer to I2C_MasterWriteByte()
+//     transport - pointer to the transport connecting
+//                 the display (e.g. from oled_I2CTransport())
+//     updateMode - OLED_UPDATE_IMMEDIATE or OLED_UPDATE_DEFERRED
 //======================================
-void oled_Init(oled_t * oled, uint8 slaveAddr, uint8 (*SendStart)(uint8, uint8), uint8 (*SendStop)(void), uint8 (*WriteByte)(uint8));
+void oled_Init(oled_t * oled, oled_transport_t * transport, uint8 updateMode);
+
+//========================================
+// oled_Flush()
+// this function sends all changes made to
+// GRAM since the last flush to the display.
+// Only needed in OLED_UPDATE_DEFERRED mode.
+// The modified columns of each page are 
+// grouped into the set of windows that is
+// cheapest to send over the bus
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_Flush(oled_t * oled);
+
+//========================================
+// oled_FlushRect()
+// this function sends the rectangle of GRAM
+// defined by its upper left corner (x0, y0) 
+// and lower right corner (x1, y1) to the
+// display. The rectangle is rounded out to
+// whole pages (multiples of 8 rows)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//========================================
+void oled_FlushRect(oled_t * oled, int x0, int y0, int x1, int y1);
+
+//========================================
+// oled_SetShadow()
+// this function gives the oled a buffer in
+// which to keep a copy of what the display
+// holds (everything sent to it). The buffer
+// is needed by oled_Sync(). The first 
+// oled_Sync() after this call sends the 
+// whole screen
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     shadow - pointer to an array of 
+//              OLED_WIDTH*(OLED_HEIGHT/8) bytes,
+//              or NULL to stop using it
+//========================================
+void oled_SetShadow(oled_t * oled, uint8 * shadow);
+
+//========================================
+// oled_Sync()
+// this function sends only the bytes of GRAM
+// that differ from what the display holds.
+// Runs of changed bytes that are close together
+// are sent as one window when that is cheaper
+// than opening a new one. Use in place of 
+// oled_Flush() when each frame is redrawn from 
+// scratch (i.e. oled_Clear() followed by 
+// drawing). Without a shadow buffer (see 
+// oled_SetShadow()) this is the same as 
+// oled_Flush()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_Sync(oled_t * oled);
+
+//========================================
+// oled_SetTransport()
+// this function switches the oled to another
+// transport (e.g. from blocking to interrupt
+// driven I2C transfers) once everything queued
+// on the current one has been sent. With a
+// transport that sends in the background, 
+// functions that update the display queue the
+// modified columns of each page and return 
+// immediately. Queued pages are sent one 
+// transfer at a time by oled_IsBusy(). When
+// every page is queued in full, the whole frame
+// is sent as one window followed by a chain of
+// data only transfers
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     transport - pointer to the new transport
+//========================================
+void oled_SetTransport(oled_t * oled, oled_transport_t * transport);
+
+//========================================
+// oled_SetOnComplete()
+// this function sets a function to be called
+// (from oled_IsBusy()) each time the queue of
+// background transfers has been emptied
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     OnComplete - completion callback, or NULL
+//========================================
+void oled_SetOnComplete(oled_t * oled, void (*OnComplete)(oled_t *));
+
+//========================================
+// oled_IsBusy()
+// this function returns 1 while background
+// transfers are in progress or queued, 0 otherwise.
+// Each call also starts the next queued transfer
+// once the bus is free, so it should be called 
+// regularly (e.g. once per pass of the main loop)
+// until it returns 0
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+uint8 oled_IsBusy(oled_t * oled);
+
+//========================================
+// oled_SetBackBuffer()
+// this function turns on double buffering.
+// Drawing functions then modify a back buffer
+// while the front buffer is sent to the display,
+// and oled_Present() swaps the two. Use 
+// oled_Present() in place of oled_Flush().
+// Turning it on or off carries on from the
+// frame on the display, except on pages drawn
+// on since the last oled_Present(): these 
+// keep the drawing and are sent by the next
+// flush
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     back - pointer to an array of OLED_GRAM_SIZE
+//            bytes used as the second buffer, or
+//            NULL to turn double buffering off
+//========================================
+void oled_SetBackBuffer(oled_t * oled, uint8 * back);
+
+//========================================
+// oled_Present()
+// this function shows the frame drawn since the
+// last call: the back and front buffers are swapped
+// (no copying) and the changes are sent from the
+// new front buffer. With background transfers
+// (see oled_SetTransport()) the function returns as soon
+// as the transfer is queued, and only waits if the
+// previous frame is still being sent. After the swap
+// the back buffer holds the frame before the one
+// presented, so frames should be redrawn in full.
+// Without a back buffer this is the same as oled_Flush()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_Present(oled_t * oled);
 
 //========================================
 // oled_SetColor()
@@ -142,9 +389,10 @@ uint8 oled_GetPenSize(oled_t * oled);
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
-//     font - pointer to a font_t structure
+//     font - pointer to a font_t structure (e.g. &font,
+//            &fontProp)
 //========================================
-void oled_SetFont(oled_t * oled, font_t * font);
+void oled_SetFont(oled_t * oled, const font_t * font);
 
 //========================================
 // oled_SetBmMode()
@@ -188,10 +436,85 @@ void oled_SetTextMode(oled_t * oled, uint8 textMode);
 //========================================
 uint8 oled_GetTextMode(oled_t * oled);
 
+//========================================
+// oled_SetRasterOp()
+// this function sets how drawing functions
+// (shapes, bitmaps and text) combine the 
+// pixels they draw with GRAM. With OLED_ROP_XOR,
+// drawing something a second time erases it,
+// e.g. a cursor or a rubber-band rectangle, 
+// without redrawing what was under it. Pixels
+// are combined as if white were 1 and black 0,
+// so OR, AND-NOT and XOR only change pixels 
+// drawn in white. oled_Clear(), oled_ClearRect()
+// and oled_InvertRect() are not affected. Each
+// pixel of a shape is drawn once, except where
+// the corners of oled_DrawRoundedRect() meet
+// its sides and, with a pen size above 0, 
+// where the edges of oled_DrawPolygon() meet
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     rop - OLED_ROP_COPY, OLED_ROP_OR, 
+//           OLED_ROP_AND_NOT or OLED_ROP_XOR
+//========================================
+void oled_SetRasterOp(oled_t * oled, uint8 rop);
+
+//========================================
+// oled_GetRasterOp()
+// this function returns the raster operation
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+uint8 oled_GetRasterOp(oled_t * oled);
+
+//========================================
+// oled_PushClip()
+// this function saves the current viewport 
+// and makes the rectangle defined by its upper
+// left corner (x0, y0) and lower right corner
+// (x1, y1) the new one: drawing functions only
+// draw inside it (and inside the viewports it
+// is pushed in), and their coordinates are 
+// relative to (x0, y0). Widgets can then redraw
+// themselves without drawing over their 
+// neighbours. oled_Clear() clears the viewport.
+// Shapes entirely outside it are rejected 
+// before they are drawn. oled_FlushRect() 
+// still takes display coordinates
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//
+// Returns:
+//     1 if the viewport was pushed, 0 if 
+//     OLED_CLIP_DEPTH viewports are already 
+//     saved (nothing is changed)
+//========================================
+uint8 oled_PushClip(oled_t * oled, int x0, int y0, int x1, int y1);
+
+//========================================
+// oled_PopClip()
+// this function restores the viewport saved
+// by the last successful oled_PushClip(). 
+// Without one the whole display is the 
+// viewport
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//========================================
+void oled_PopClip(oled_t * oled);
+
 //========================================
 // oled_Clear()
 // this functions clears the screan (fills it
-// with the background color)
+// with the background color), or only the
+// viewport (see oled_PushClip())
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
@@ -214,6 +537,22 @@ void oled_Clear(oled_t * oled);
 //========================================
 
 void oled_ClearRect(oled_t * oled, int x0, int y0, int x1, int y1);
+
+//========================================
+// oled_InvertRect()
+// this functions inverts the pixels of a 
+// rectangle defined by its upper left corner
+// (x0, y0) and lower right corner (x1, y1),
+// e.g. to highlight a menu item
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - upper left x-coordinate
+//     y0 - upper left y-coordinate
+//     x1 - lower right x-coordinate
+//     y1 - lower right y-coordinate
+//========================================
+void oled_InvertRect(oled_t * oled, int x0, int y0, int x1, int y1);
 //========================================
 // oled_DrawPixel()
 // this function fills the pixel located at (x, y)
@@ -380,13 +719,180 @@ void oled_DrawPoint(oled_t * oled, int xc, int yc);
 //========================================
 void oled_DrawPie(oled_t * oled, int xc, int yc, int r, int a0, int a1);
 
+//========================================
+// oled_DrawArcAngle()
+// this function draws an arc of radius r
+// centered at (xc, yc) from angle a0 to angle
+// a1 (any angle, see OLED_DEGREES()). Angles 
+// increase clockwise from the right, as the
+// octants of oled_DrawArc() do (16384 = down);
+// the arc runs from a0 in that direction,
+// through 0 if a1 < a0. a0 == a1 draws the
+// whole circle
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the arc (center of circle)
+//     yc - y-coordinate of the center of the arc (center of circle)
+//     r - radius of arc
+//     a0 - start angle (65536 = one turn)
+//     a1 - end angle (65536 = one turn)
+//========================================
+void oled_DrawArcAngle(oled_t * oled, int xc, int yc, int r, uint16 a0, uint16 a1);
+
+//========================================
+// oled_DrawPieAngle()
+// this function draws a circular sector of
+// radius r centered at (xc, yc) from angle a0
+// to angle a1 (see oled_DrawArcAngle())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the sector (center of circle)
+//     yc - y-coordinate of the center of the sector (center of circle)
+//     r - radius of circular sector
+//     a0 - start angle (65536 = one turn)
+//     a1 - end angle (65536 = one turn)
+//========================================
+void oled_DrawPieAngle(oled_t * oled, int xc, int yc, int r, uint16 a0, uint16 a1);
+
+//========================================
+// oled_DrawEllipse()
+// this function draws an ellipse centered at
+// (xc, yc) with horizontal radius rx and 
+// vertical radius ry, using the midpoint 
+// ellipse algorithm. The pen size widens the
+// outline as it does for oled_DrawCircle()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the ellipse
+//     yc - y-coordinate of the center of the ellipse
+//     rx - horizontal radius (up to OLED_ELLIPSE_RADIUS
+//          with the pen)
+//     ry - vertical radius (up to OLED_ELLIPSE_RADIUS
+//          with the pen)
+//========================================
+void oled_DrawEllipse(oled_t * oled, int xc, int yc, int rx, int ry);
+
+//========================================
+// oled_FillEllipse()
+// this function fills an ellipse centered at
+// (xc, yc) with horizontal radius rx and
+// vertical radius ry (see oled_DrawEllipse())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     xc - x-coordinate of the center of the ellipse
+//     yc - y-coordinate of the center of the ellipse
+//     rx - horizontal radius (up to OLED_ELLIPSE_RADIUS)
+//     ry - vertical radius (up to OLED_ELLIPSE_RADIUS)
+//========================================
+void oled_FillEllipse(oled_t * oled, int xc, int yc, int rx, int ry);
+
+//========================================
+// oled_FillPolygon()
+// this function fills the polygon with the
+// n corners given, in order, by points. The
+// polygon may be concave or cross itself:
+// the parts inside an odd number of its
+// edges are filled, together with the edges
+// themselves. Each row is filled as a few
+// spans, each with a single GRAM operation
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     points - pointer to an array of n (x, y)
+//              pairs (2*n values)
+//     n - number of corners (1 to 
+//         OLED_POLYGON_POINTS)
+//========================================
+void oled_FillPolygon(oled_t * oled, const int16 * points, uint8 n);
+
+//========================================
+// oled_DrawPolygon()
+// this function draws the outline of the 
+// polygon with the n corners given, in order,
+// by points. With pen size 0 (and up to 
+// OLED_POLYGON_POINTS corners) the outline is
+// scanned row by row like oled_FillPolygon(),
+// so each pixel is drawn once, corners and
+// crossings included. Otherwise its edges are
+// drawn as lines (see oled_DrawLine()) with
+// the current pen size
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     points - pointer to an array of n (x, y)
+//              pairs (2*n values)
+//     n - number of corners
+//========================================
+void oled_DrawPolygon(oled_t * oled, const int16 * points, uint8 n);
+
+//========================================
+// oled_FillTriangle()
+// this function fills the triangle with 
+// corners (x0, y0), (x1, y1) and (x2, y2)
+// (see oled_FillPolygon())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate of the first corner
+//     y0 - y-coordinate of the first corner
+//     x1 - x-coordinate of the second corner
+//     y1 - y-coordinate of the second corner
+//     x2 - x-coordinate of the third corner
+//     y2 - y-coordinate of the third corner
+//========================================
+void oled_FillTriangle(oled_t * oled, int x0, int y0, int x1, int y1, int x2, int y2);
+
+//========================================
+// oled_DrawTriangle()
+// this function draws the outline of the 
+// triangle with corners (x0, y0), (x1, y1) and
+// (x2, y2) (see oled_DrawPolygon())
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate of the first corner
+//     y0 - y-coordinate of the first corner
+//     x1 - x-coordinate of the second corner
+//     y1 - y-coordinate of the second corner
+//     x2 - x-coordinate of the third corner
+//     y2 - y-coordinate of the third corner
+//========================================
+void oled_DrawTriangle(oled_t * oled, int x0, int y0, int x1, int y1, int x2, int y2);
+
+//========================================
+// oled_SetSpanCache()
+// this function gives the oled an array of
+// entries in which to keep the spans of the
+// circles, arcs and pies it draws (see
+// oled_DrawCircle()), so that shapes redrawn
+// every frame (e.g. gauges or indicator dots)
+// skip computing them. Only shapes with an
+// outer radius up to OLED_SPAN_CACHE_RADIUS
+// are cached; the least recently used entry
+// is replaced
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     cache - pointer to an array of entries,
+//             or NULL to stop using it
+//     size - number of entries
+//========================================
+void oled_SetSpanCache(oled_t * oled, oled_span_cache_t * cache, uint8 size);
+
 //======================================
 // oled_DispBitmap()
 // this function displays the given bitmap
 // with its top left corner at (x0, y0). 
 // Option for how the bitmap is displayed 
 // can be found in the user manual and can
-// be set using oled_SetBmMode() 
+// be set using oled_SetBmMode(). The bitmap
+// is converted to GRAM format 8x8 pixels at
+// a time and sent to the display as a single
+// block
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
@@ -399,6 +905,55 @@ void oled_DrawPie(oled_t * oled, int xc, int yc, int r, int a0, int a1);
 //======================================
 void oled_DispBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16 width, uint16 height);
 
+//========================================
+// oled_DispPageBitmap()
+// this function displays the given bitmap
+// with its top left corner at (x0, y0), like
+// oled_DispBitmap(), but takes the bitmap in
+// GRAM format (see host/xbm2page.c): pages of
+// 8 rows, each page stored as one byte per
+// column with bit 0 the top pixel. When y0 is
+// a multiple of 8 and the bitmap mode is 
+// OLED_BM_NORMAL, whole pages are copied 
+// straight into GRAM
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate for upper left corner of bitmap
+//     y0 - y-coordinate for upper left corner of bitmap
+//     bitmap - pointer to an array of (height+7)/8 pages
+//              of width bytes each
+//     width - width of the bitmap (in pixels)
+//     height - height of the bitmap (in pixels)
+//========================================
+void oled_DispPageBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16 width, uint16 height);
+
+//========================================
+// oled_DispRLEBitmap()
+// this function displays the given bitmap
+// with its top left corner at (x0, y0), like
+// oled_DispPageBitmap(), but takes the bitmap
+// compressed (see host/xbm2page.c -r). It is
+// expanded a byte at a time straight into
+// GRAM, without a buffer for the whole bitmap.
+// The compressed bitmap is a series of packets,
+// each one a control byte c followed by:
+//     c < 0x80: c+1 bytes of the bitmap
+//     c >= 0x80: one byte, repeated (c & 0x7F)+2
+//                times
+// which expand to the (height+7)/8 pages of
+// width bytes of oled_DispPageBitmap()
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     x0 - x-coordinate for upper left corner of bitmap
+//     y0 - y-coordinate for upper left corner of bitmap
+//     bitmap - pointer to the compressed bitmap
+//     width - width of the bitmap (in pixels)
+//     height - height of the bitmap (in pixels)
+//========================================
+void oled_DispRLEBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16 width, uint16 height);
+
 //========================================
 // oled_DispChar()
 // this function displays the character c
@@ -406,7 +961,10 @@ void oled_DispBitmap(oled_t * oled, int x0, int y0, const uint8 * bitmap, uint16
 // character is displayed in the font specified
 // by oled.font. Option for how the character is 
 // displayed can be found in the user manual 
-// and can be set using oled_SetTextMode()
+// and can be set using oled_SetTextMode().
+// The character is copied from the font into
+// GRAM a page at a time, and is as wide as the
+// font says (fonts may be proportional)
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
@@ -425,7 +983,11 @@ void oled_DispChar(oled_t * oled, int x0, int y0, const char c);
 // at (x0, y0). The characters are displayed in the 
 // font specified by oled.font. Option for how the 
 // characters are displayed can be found in the user
-// manual and can be set using oled_SetTextMode()
+// manual and can be set using oled_SetTextMode().
+// Each character is placed right after the
+// previous one. Each line of the string is
+// composed in RAM and drawn into GRAM in one go,
+// then sent to the display as a single block
 //
 // Parameters:
 //     oled - pointer to a oled_t structure
@@ -437,6 +999,25 @@ void oled_DispChar(oled_t * oled, int x0, int y0, const char c);
 //========================================
 void oled_DispString(oled_t * oled, int x0, int y0, const char * s);
 
+//========================================
+// oled_MeasureString()
+// this function returns the size of the area
+// oled_DispString() draws the string s in,
+// without drawing anything (e.g. to clear the
+// previous text before displaying new text
+// of a different length)
+//
+// Parameters:
+//     oled - pointer to a oled_t structure
+//     s - pointer to the string
+//     width - set to the width of the widest line
+//             (0 if the string has no characters)
+//     height - set to the height from the top of
+//              the first line to the bottom of the 
+//              last line holding characters
+//========================================
+void oled_MeasureString(oled_t * oled, const char * s, int * width, int * height);
+
 #endif
 
 //========================================
@@ -0,0 +1,246 @@
+//======================================
+// include
+//======================================
+#include "oled_i2c.h"
+
+//======================================
+// private function declarations
+//======================================
+uint8 I2CWriteCmds(void * bus, const uint8 * cmds, uint8 count);
+uint16 I2CWriteData(void * bus, const uint8 * data, uint16 count);
+void I2CFlush(void * bus);
+uint8 I2CBusy(void * bus);
+void I2CPut(oled_i2c_t * i2c, uint8 byte);
+void I2CSetup(oled_i2c_t * i2c, uint8 slaveAddr);
+
+//========================================
+// oled_I2CTransport()
+// this function sets up a transport that sends
+// to the display with blocking I2C transfers.
+// Commands are sent one per control byte (Co = 1)
+// so that GRAM data can follow in the same
+// transaction
+//
+// Parameters:
+//     i2c - pointer to a oled_i2c_t structure
+//     slaveAddr - 7-bit I2C address
+//     SendStart - function pointer to I2C_MasterSendStart()
+//     SendStop - function pointer to I2C_MasterSendStop()
+//     WriteByte - function pointer to I2C_MasterWriteByte()
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_I2CTransport(oled_i2c_t * i2c, uint8 slaveAddr, uint8 (*SendStart)(uint8, uint8), uint8 (*SendStop)(void), uint8 (*WriteByte)(uint8))
+{
+    I2CSetup(i2c, slaveAddr);
+    i2c->SendStart = SendStart;                     // pass the I2C_MasterSendStart() function
+    i2c->SendStop = SendStop;                       // pass the I2C_MasterSendStop() function
+    i2c->WriteByte = WriteByte;                     // pass the I2C_MasterWriteByte() function
+    i2c->transport.Busy = NULL;                     // transfers are complete when Flush() returns
+    return &i2c->transport;
+}
+
+//========================================
+// oled_I2CAsyncTransport()
+// this function sets up a transport that sends
+// to the display with interrupt driven I2C
+// transfers: each transaction is built in a
+// buffer and handed to I2C_MasterWriteBuf(),
+// so the CPU is free while it is on the bus.
+// The buffer is supplied by the caller, so
+// that blocking transports do not carry one
+//
+// Parameters:
+//     i2c - pointer to a oled_i2c_t structure
+//     slaveAddr - 7-bit I2C address
+//     buf - transaction buffer, kept for as long
+//           as the transport is used
+//     size - size of buf (OLED_I2C_BUF_SIZE;
+//            at least 14 for one window and a
+//            byte of data)
+//     WriteBuf - function pointer to I2C_MasterWriteBuf()
+//     MasterStatus - function pointer to I2C_MasterStatus()
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_I2CAsyncTransport(oled_i2c_t * i2c, uint8 slaveAddr, uint8 * buf, uint8 size, uint8 (*WriteBuf)(uint8, uint8 *, uint8, uint8), uint8 (*MasterStatus)(void))
+{
+    I2CSetup(i2c, slaveAddr);
+    i2c->buf = buf;
+    i2c->size = size;
+    i2c->WriteBuf = WriteBuf;                       // pass the I2C_MasterWriteBuf() function
+    i2c->MasterStatus = MasterStatus;               // pass the I2C_MasterStatus() function
+    i2c->transport.Busy = I2CBusy;                  // Flush() only starts the transfer
+    return &i2c->transport;
+}
+
+//======================================
+// I2CSetup()
+// this function sets the fields shared by
+// the blocking and interrupt driven transports
+//
+// Parameters:
+//     i2c - pointer to a oled_i2c_t structure
+//     slaveAddr - 7-bit I2C address
+//======================================
+void I2CSetup(oled_i2c_t * i2c, uint8 slaveAddr)
+{
+    i2c->transport.bus = i2c;
+    i2c->transport.WriteCmds = I2CWriteCmds;
+    i2c->transport.WriteData = I2CWriteData;
+    i2c->transport.Flush = I2CFlush;
+    i2c->transport.windowCost = OLED_I2C_WINDOW_COST;
+    i2c->slaveAddr = slaveAddr;                     // set oled's I2C address
+    i2c->SendStart = NULL;
+    i2c->SendStop = NULL;
+    i2c->WriteByte = NULL;
+    i2c->WriteBuf = NULL;
+    i2c->MasterStatus = NULL;
+    i2c->buf = NULL;
+    i2c->size = 0;
+    i2c->state = OLED_I2C_IDLE;
+    i2c->count = 0;
+    i2c->pending = 0;
+    i2c->active = 0;
+}
+
+//======================================
+// I2CPut()
+// this function adds one byte to the current
+// transaction, opening it if needed
+//
+// Parameters:
+//     i2c - pointer to a oled_i2c_t structure
+//     byte - byte to send
+//======================================
+void I2CPut(oled_i2c_t * i2c, uint8 byte)
+{
+    if (i2c->WriteBuf != NULL){                     // interrupt driven: collect the byte in buf
+        i2c->buf[i2c->count++] = byte;
+        return;
+    }
+    if (i2c->state == OLED_I2C_IDLE){
+        i2c->SendStart(i2c->slaveAddr, 0x00);       // generate Start condition and send slave address with R/W# bit = 0 (write mode)
+    }
+    i2c->WriteByte(byte);
+}
+
+//======================================
+// I2CWriteCmds()
+// this function adds count commands to the
+// current transaction, each preceded by a
+// "single command" control byte (Co = 1).
+// Commands must come before any data. The
+// commands are taken all together or not at
+// all, so a window command is never cut short
+//
+// Parameters:
+//     bus - pointer to a oled_i2c_t structure
+//     cmds - commands and their parameters
+//     count - number of bytes in cmds
+//
+// Returns:
+//     count, or 0 if the commands and their
+//     control bytes do not all fit in buf
+//======================================
+uint8 I2CWriteCmds(void * bus, const uint8 * cmds, uint8 count)
+{
+    oled_i2c_t * i2c = bus;
+    if ((i2c->WriteBuf != NULL) && (2*count > i2c->size - i2c->count)) return 0;   // no room for all of them
+    for (int i=0; i<count; i++){
+        I2CPut(i2c, 0x80);                          // "single command" control byte
+        i2c->state = OLED_I2C_CMDS;
+        I2CPut(i2c, cmds[i]);
+    }
+    return count;
+}
+
+//======================================
+// I2CWriteData()
+// this function adds GRAM data to the current
+// transaction. The "GRAM write" control byte is
+// sent once, before the first data byte
+//
+// Parameters:
+//     bus - pointer to a oled_i2c_t structure
+//     data - GRAM data
+//     count - number of bytes in data
+//
+// Returns:
+//     number of bytes taken (all of them for
+//     blocking transfers, as many as fit in buf
+//     for interrupt driven transfers)
+//======================================
+uint16 I2CWriteData(void * bus, const uint8 * data, uint16 count)
+{
+    oled_i2c_t * i2c = bus;
+    if (i2c->state != OLED_I2C_DATA){
+        if ((i2c->WriteBuf != NULL) && (i2c->count > i2c->size - 2)) return 0;  // no room for the control byte and any data
+        I2CPut(i2c, 0x40);                          // "GRAM write" control byte
+        i2c->state = OLED_I2C_DATA;
+    }
+    if ((i2c->WriteBuf != NULL) && (count > i2c->size - i2c->count)){
+        count = i2c->size - i2c->count;             // take as much as fits in buf
+    }
+    for (int i=0; i<count; i++){
+        I2CPut(i2c, data[i]);
+    }
+    return count;
+}
+
+//======================================
+// I2CFlush()
+// this function ends the current transaction.
+// Blocking transfers generate the Stop condition,
+// interrupt driven transfers hand buf to
+// I2C_MasterWriteBuf()
+//
+// Parameters:
+//     bus - pointer to a oled_i2c_t structure
+//======================================
+void I2CFlush(void * bus)
+{
+    oled_i2c_t * i2c = bus;
+    if (i2c->state == OLED_I2C_IDLE) return;        // nothing to send
+    i2c->state = OLED_I2C_IDLE;
+    if (i2c->WriteBuf == NULL){
+        i2c->SendStop();                            // generate Stop condition
+        return;
+    }
+    i2c->pending = 1;
+    I2CBusy(i2c);                                   // start the transfer if the bus is free
+}
+
+//======================================
+// I2CBusy()
+// this function returns 1 while an interrupt
+// driven transfer is waiting for the bus or
+// on the bus, 0 otherwise. A waiting transfer
+// is started as soon as the bus is free
+//
+// Parameters:
+//     bus - pointer to a oled_i2c_t structure
+//======================================
+uint8 I2CBusy(void * bus)
+{
+    oled_i2c_t * i2c = bus;
+    if (i2c->active){
+        if (i2c->MasterStatus() & OLED_I2C_MSTAT_XFER_INP) return 1;   // buf is still on the bus
+        i2c->active = 0;
+    }
+    if (i2c->pending){
+        if (i2c->WriteBuf(i2c->slaveAddr, i2c->buf, i2c->count, 0x00) == 0){    // 0x00: complete transfer with Start and Stop (try again on the next call if the bus is not free yet)
+            i2c->pending = 0;
+            i2c->active = 1;
+            i2c->count = 0;                         // buf is reused once the transfer has completed
+        }
+        return 1;
+    }
+    return 0;
+}
+
+//========================================
+// END OF FILE
+//========================================
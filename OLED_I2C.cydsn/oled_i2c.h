@@ -0,0 +1,93 @@
+#ifndef _OLED_I2C_H
+#define _OLED_I2C_H
+
+//======================================
+// include
+//======================================
+#include "project.h"
+#include "oled_transport.h"
+
+//======================================
+// I2C transport settings
+//======================================
+#define OLED_I2C_BUF_SIZE 255           // largest buffer I2C_MasterWriteBuf() can send, and the size to give oled_I2CAsyncTransport() (one window followed by at least one page of data)
+#define OLED_I2C_MSTAT_XFER_INP 0x04    // "transfer in progress" bit of the value returned by I2C_MasterStatus()
+#define OLED_I2C_WINDOW_COST 15         // bus cost (in bytes) of opening a window: slave address, 6 command bytes with their control bytes, "GRAM write" control byte, plus ~1 byte for the Start/Stop pair
+
+//======================================
+// I2C transport struct
+//======================================
+typedef struct {
+    oled_transport_t transport;                         // transport handed to oled_Init()
+    uint8 slaveAddr;                                    // oled I2C address
+    uint8 (*SendStart)(uint8 slaveAddr, uint8 R_nW);    // function pointer to I2C_MasterSendStart(). Generates an I2C Start condition and sends the slave address with the read/write bit
+    uint8 (*SendStop)(void);                            // function pointer to I2C_MasterSendStop(). Generates and I2C Stop condition
+    uint8 (*WriteByte)(uint8 byte);                     // function pointer to I2C_MasterWriteByte(). Send one byte via I2C
+    uint8 (*WriteBuf)(uint8 slaveAddr, uint8 * wrData, uint8 cnt, uint8 mode);  // function pointer to I2C_MasterWriteBuf(). Starts an interrupt driven transfer of a buffer (NULL for blocking transfers)
+    uint8 (*MasterStatus)(void);                        // function pointer to I2C_MasterStatus(). Returns the status of the interrupt driven transfer
+    uint8 state;                                        // what the current transaction holds so far (OLED_I2C_IDLE, OLED_I2C_CMDS or OLED_I2C_DATA)
+    uint8 count;                                        // number of bytes in buf
+    uint8 pending;                                      // 1 if buf is waiting for the bus
+    uint8 active;                                       // 1 while buf is being transferred
+    uint8 * buf;                                        // bytes of the current interrupt driven transfer (supplied by the caller, NULL for blocking transfers)
+    uint8 size;                                         // size of buf
+} oled_i2c_t;
+
+//======================================
+// transaction states
+//======================================
+#define OLED_I2C_IDLE 0         // no transaction open
+#define OLED_I2C_CMDS 1         // transaction holds commands
+#define OLED_I2C_DATA 2         // transaction holds GRAM data (no more commands can follow)
+
+//========================================
+// oled_I2CTransport()
+// this function sets up a transport that sends
+// to the display with blocking I2C transfers.
+// Commands are sent one per control byte (Co = 1)
+// so that GRAM data can follow in the same
+// transaction
+//
+// Parameters:
+//     i2c - pointer to a oled_i2c_t structure
+//     slaveAddr - 7-bit I2C address
+//     SendStart - function pointer to I2C_MasterSendStart()
+//     SendStop - function pointer to I2C_MasterSendStop()
+//     WriteByte - function pointer to I2C_MasterWriteByte()
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_I2CTransport(oled_i2c_t * i2c, uint8 slaveAddr, uint8 (*SendStart)(uint8, uint8), uint8 (*SendStop)(void), uint8 (*WriteByte)(uint8));
+
+//========================================
+// oled_I2CAsyncTransport()
+// this function sets up a transport that sends
+// to the display with interrupt driven I2C
+// transfers: each transaction is built in a
+// buffer and handed to I2C_MasterWriteBuf(),
+// so the CPU is free while it is on the bus.
+// The buffer is supplied by the caller, so
+// that blocking transports do not carry one
+//
+// Parameters:
+//     i2c - pointer to a oled_i2c_t structure
+//     slaveAddr - 7-bit I2C address
+//     buf - transaction buffer, kept for as long
+//           as the transport is used
+//     size - size of buf (OLED_I2C_BUF_SIZE;
+//            at least 14 for one window and a
+//            byte of data)
+//     WriteBuf - function pointer to I2C_MasterWriteBuf()
+//     MasterStatus - function pointer to I2C_MasterStatus()
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_I2CAsyncTransport(oled_i2c_t * i2c, uint8 slaveAddr, uint8 * buf, uint8 size, uint8 (*WriteBuf)(uint8, uint8 *, uint8, uint8), uint8 (*MasterStatus)(void));
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
@@ -0,0 +1,140 @@
+//======================================
+// include
+//======================================
+#include "oled_spi.h"
+
+//======================================
+// private function declarations
+//======================================
+uint8 SPIWriteCmds(void * bus, const uint8 * cmds, uint8 count);
+uint16 SPIWriteData(void * bus, const uint8 * data, uint16 count);
+void SPIFlush(void * bus);
+void SPISetDC(oled_spi_t * spi, uint8 dc);
+void SPIDrain(oled_spi_t * spi);
+
+//========================================
+// oled_SPITransport()
+// this function sets up a transport that sends
+// to the display over 4-wire SPI (SCLK, MOSI,
+// CS# driven by the SPIM's SS line, and D/C#).
+// Bytes are passed to the SPIM in blocks; the
+// bus is only drained when D/C# must change
+//
+// Parameters:
+//     spi - pointer to a oled_spi_t structure
+//     PutArray - function pointer to SPIM_PutArray()
+//     ReadTxStatus - function pointer to SPIM_ReadTxStatus()
+//     WriteDC - function pointer to the D/C# pin's Write() function
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_SPITransport(oled_spi_t * spi, void (*PutArray)(const uint8[], uint8), uint8 (*ReadTxStatus)(void), void (*WriteDC)(uint8))
+{
+    spi->transport.bus = spi;
+    spi->transport.WriteCmds = SPIWriteCmds;
+    spi->transport.WriteData = SPIWriteData;
+    spi->transport.Flush = SPIFlush;
+    spi->transport.Busy = NULL;                     // transfers are complete when Flush() returns
+    spi->transport.windowCost = OLED_SPI_WINDOW_COST;
+    spi->PutArray = PutArray;                       // pass the SPIM_PutArray() function
+    spi->ReadTxStatus = ReadTxStatus;               // pass the SPIM_ReadTxStatus() function
+    spi->WriteDC = WriteDC;                         // pass the D/C# pin's Write() function
+    spi->dc = 0xFF;                                 // D/C# level unknown
+    return &spi->transport;
+}
+
+//======================================
+// SPIDrain()
+// this function waits until every byte handed
+// to the SPIM has been shifted out
+//
+// Parameters:
+//     spi - pointer to a oled_spi_t structure
+//======================================
+void SPIDrain(oled_spi_t * spi)
+{
+    uint8 done = OLED_SPI_STS_TX_FIFO_EMPTY | OLED_SPI_STS_SPI_IDLE;
+    while ((spi->ReadTxStatus() & done) != done);
+}
+
+//======================================
+// SPISetDC()
+// this function sets the D/C# pin, first
+// waiting for the bytes sent with the old
+// level to leave the bus
+//
+// Parameters:
+//     spi - pointer to a oled_spi_t structure
+//     dc - 0 (command) or 1 (data)
+//======================================
+void SPISetDC(oled_spi_t * spi, uint8 dc)
+{
+    if (spi->dc == dc) return;
+    SPIDrain(spi);
+    spi->WriteDC(dc);
+    spi->dc = dc;
+}
+
+//======================================
+// SPIWriteCmds()
+// this function sends count command bytes
+//
+// Parameters:
+//     bus - pointer to a oled_spi_t structure
+//     cmds - commands and their parameters
+//     count - number of bytes in cmds
+//
+// Returns:
+//     count (SPI sends everything)
+//======================================
+uint8 SPIWriteCmds(void * bus, const uint8 * cmds, uint8 count)
+{
+    oled_spi_t * spi = bus;
+    SPISetDC(spi, 0);
+    spi->PutArray(cmds, count);
+    return count;
+}
+
+//======================================
+// SPIWriteData()
+// this function sends count bytes of GRAM
+// data, in blocks of up to OLED_SPI_CHUNK_SIZE
+//
+// Parameters:
+//     bus - pointer to a oled_spi_t structure
+//     data - GRAM data
+//     count - number of bytes in data
+//
+// Returns:
+//     number of bytes taken (always count)
+//======================================
+uint16 SPIWriteData(void * bus, const uint8 * data, uint16 count)
+{
+    oled_spi_t * spi = bus;
+    SPISetDC(spi, 1);
+    uint16 n;
+    for (uint16 i=0; i<count; i+=n){
+        n = count - i;
+        if (n > OLED_SPI_CHUNK_SIZE) n = OLED_SPI_CHUNK_SIZE;
+        spi->PutArray(&data[i], n);
+    }
+    return count;
+}
+
+//======================================
+// SPIFlush()
+// this function waits for the end of the
+// transfer
+//
+// Parameters:
+//     bus - pointer to a oled_spi_t structure
+//======================================
+void SPIFlush(void * bus)
+{
+    SPIDrain(bus);
+}
+
+//========================================
+// END OF FILE
+//========================================
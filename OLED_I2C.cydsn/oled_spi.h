@@ -0,0 +1,52 @@
+#ifndef _OLED_SPI_H
+#define _OLED_SPI_H
+
+//======================================
+// include
+//======================================
+#include "project.h"
+#include "oled_transport.h"
+
+//======================================
+// SPI transport settings
+//======================================
+#define OLED_SPI_STS_TX_FIFO_EMPTY 0x02     // "Tx FIFO empty" bit of the value returned by SPIM_ReadTxStatus()
+#define OLED_SPI_STS_SPI_IDLE 0x10          // "SPI idle" bit of the value returned by SPIM_ReadTxStatus()
+#define OLED_SPI_CHUNK_SIZE 255             // largest number of bytes SPIM_PutArray() takes at once
+#define OLED_SPI_WINDOW_COST 8              // bus cost (in bytes) of opening a window: 6 command bytes, plus ~2 for draining the bus around the D/C# changes
+
+//======================================
+// SPI transport struct
+//======================================
+typedef struct {
+    oled_transport_t transport;                                 // transport handed to oled_Init()
+    void (*PutArray)(const uint8 buffer[], uint8 byteCount);    // function pointer to SPIM_PutArray(). Places an array of bytes in the Tx FIFO (waits while the FIFO is full)
+    uint8 (*ReadTxStatus)(void);                                // function pointer to SPIM_ReadTxStatus(). Returns the status of the transmitter
+    void (*WriteDC)(uint8 value);                               // function pointer to the Write() function of the D/C# pin (0: command, 1: data)
+    uint8 dc;                                                   // current level of the D/C# pin (0xFF if unknown)
+} oled_spi_t;
+
+//========================================
+// oled_SPITransport()
+// this function sets up a transport that sends
+// to the display over 4-wire SPI (SCLK, MOSI,
+// CS# driven by the SPIM's SS line, and D/C#).
+// Bytes are passed to the SPIM in blocks; the
+// bus is only drained when D/C# must change
+//
+// Parameters:
+//     spi - pointer to a oled_spi_t structure
+//     PutArray - function pointer to SPIM_PutArray()
+//     ReadTxStatus - function pointer to SPIM_ReadTxStatus()
+//     WriteDC - function pointer to the D/C# pin's Write() function
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_SPITransport(oled_spi_t * spi, void (*PutArray)(const uint8[], uint8), uint8 (*ReadTxStatus)(void), void (*WriteDC)(uint8));
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
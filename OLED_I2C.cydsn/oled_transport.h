@@ -0,0 +1,36 @@
+#ifndef _OLED_TRANSPORT_H
+#define _OLED_TRANSPORT_H
+
+//======================================
+// include
+//======================================
+#include "project.h"
+
+//======================================
+// transport struct
+//======================================
+// A transport moves commands and GRAM data to
+// the display. A transfer to the display is made
+// of WriteCmds() and WriteData() calls ended by
+// Flush(). Commands and data may be freely mixed
+// within a transfer: each backend encodes and
+// batches them in the way that suits its bus.
+// Backends with a Busy() function send in the
+// background: Flush() only starts the transfer,
+// and no new transfer may begin until Busy()
+// returns 0
+//======================================
+typedef struct oled_transport_s {
+    void * bus;                                                         // backend state, passed to every function
+    uint8 (*WriteCmds)(void * bus, const uint8 * cmds, uint8 count);    // add count command bytes to the transfer. Returns count, or 0 if they do not all fit in the backend's buffer (none are added, so no command is cut short)
+    uint16 (*WriteData)(void * bus, const uint8 * data, uint16 count);  // add up to count bytes of GRAM data to the transfer. Returns the number of bytes taken (less than count once the backend's buffer is full)
+    void (*Flush)(void * bus);                                          // end the transfer (background backends start sending it)
+    uint8 (*Busy)(void * bus);                                          // returns 1 while a background transfer is in progress (NULL if Flush() only returns once everything has been sent)
+    uint8 windowCost;                                                   // bus cost (in bytes) of opening a window on the display, used to group flushes
+} oled_transport_t;
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
@@ -0,0 +1,354 @@
+//======================================
+// include
+//======================================
+#include <stdio.h>
+#include <string.h>
+#include "oled.h"
+#include "oled_i2c.h"
+#include "i2c_oled.h"
+#include "scenes.h"
+
+//======================================
+// bench
+// runs a standard workload for each public
+// drawing function on the emulated bus and
+// reports what it costs on the I2C bus, once
+// with every call sent immediately and once
+// drawn in GRAM and sent by oled_Flush()
+//
+// usage: bench [baseline]
+// with a baseline (a previous output of bench)
+// the exit status is 1 if any workload now
+// puts more bytes on the bus
+//======================================
+
+//======================================
+// bus timing
+//======================================
+#define BITS_PER_BYTE 9             // 8 data bits and the ACK bit
+#define BITS_PER_CONDITION 1        // a Start or Stop condition takes about one bit time
+
+typedef struct {
+    const char * name;
+    void (*Run)(oled_t * oled);
+} workload_t;
+
+//========================================
+// workloads
+//========================================
+void RunPixel(oled_t * oled)
+{
+    oled_DrawPixel(oled, 64, 32);
+}
+
+void RunLines(oled_t * oled)                    // every octant, pen sizes 0-2
+{
+    const int dx[8] = {60, 20, -20, -60, -60, -20, 20, 60};
+    const int dy[8] = {20, 30, 30, 20, -20, -30, -30, -20};
+    for (int pen=0; pen<3; pen++){
+        oled_SetPenSize(oled, pen);
+        for (int i=0; i<8; i++){
+            oled_DrawLine(oled, 64, 32, 64 + dx[i], 32 + dy[i]);
+        }
+    }
+    oled_SetPenSize(oled, 0);
+}
+
+void RunTrend(oled_t * oled)                    // a trend graph: 31 connected diagonal segments
+{
+    const int y[8] = {40, 12, 30, 55, 20, 8, 45, 33};
+    for (int i=0; i<31; i++){
+        oled_DrawLine(oled, 4*i, y[i % 8], 4*(i + 1), y[(i + 1) % 8]);
+    }
+}
+
+void RunHVLines(oled_t * oled)
+{
+    oled_DrawLine(oled, 0, 31, 127, 31);
+    oled_DrawLine(oled, 63, 0, 63, 63);
+}
+
+void RunRect(oled_t * oled)
+{
+    oled_DrawRect(oled, 8, 8, 119, 55);
+}
+
+void RunRoundedRect(oled_t * oled)
+{
+    oled_DrawRoundedRect(oled, 8, 8, 119, 55, 10);
+}
+
+void RunFillRect(oled_t * oled)
+{
+    oled_FillRect(oled, 8, 8, 119, 55);
+}
+
+void RunFillRoundedRect(oled_t * oled)
+{
+    oled_FillRoundedRect(oled, 8, 8, 119, 55, 10);
+}
+
+void RunCircle(oled_t * oled)
+{
+    oled_DrawCircle(oled, 64, 32, 28);
+}
+
+void RunFillCircle(oled_t * oled)
+{
+    oled_FillCircle(oled, 64, 32, 28);
+}
+
+void RunArc(oled_t * oled)
+{
+    oled_DrawArc(oled, 64, 32, 28, 1, 4);
+}
+
+void RunPie(oled_t * oled)
+{
+    oled_DrawPie(oled, 64, 32, 28, 1, 4);
+}
+
+void RunArcAngle(oled_t * oled)                 // a progress ring, 0 to 250 degrees
+{
+    oled_SetPenSize(oled, 2);
+    oled_DrawArcAngle(oled, 64, 32, 28, OLED_DEGREES(-90), OLED_DEGREES(160));
+    oled_SetPenSize(oled, 0);
+}
+
+void RunPieAngle(oled_t * oled)                 // a gauge needle, 5 degrees wide
+{
+    oled_DrawPieAngle(oled, 64, 32, 28, OLED_DEGREES(200), OLED_DEGREES(205));
+}
+
+void RunFillTriangle(oled_t * oled)             // a gauge needle
+{
+    oled_FillTriangle(oled, 60, 36, 68, 28, 110, 8);
+}
+
+void RunDrawTriangle(oled_t * oled)
+{
+    oled_DrawTriangle(oled, 20, 56, 64, 8, 108, 56);
+}
+
+void RunFillPolygon(oled_t * oled)              // a five pointed star
+{
+    static const int16 star[] = {64, 4, 71, 23, 91, 23, 75, 36, 81, 56, 64, 44, 47, 56, 53, 36, 37, 23, 57, 23};
+    oled_FillPolygon(oled, star, 10);
+}
+
+void RunEllipse(oled_t * oled)
+{
+    oled_DrawEllipse(oled, 64, 32, 56, 24);
+}
+
+void RunFillEllipse(oled_t * oled)
+{
+    oled_FillEllipse(oled, 64, 32, 56, 24);
+}
+
+void RunPoint(oled_t * oled)
+{
+    oled_SetPenSize(oled, 2);
+    oled_DrawPoint(oled, 64, 32);
+    oled_SetPenSize(oled, 0);
+}
+
+void RunChar(oled_t * oled)
+{
+    oled_DispChar(oled, 60, 24, 'A');
+}
+
+void RunString(oled_t * oled)                   // a full screen of text
+{
+    oled_DispString(oled, 0, 0, "0123456789\nABCDEFGHIJ\nKLMNOPQRST\nabcdefghij");
+}
+
+void RunStringProp(oled_t * oled)               // the same text in the proportional font
+{
+    oled_SetFont(oled, &fontProp);
+    oled_DispString(oled, 0, 0, "0123456789\nABCDEFGHIJ\nKLMNOPQRST\nabcdefghij");
+    oled_SetFont(oled, &font);
+}
+
+void RunStringRLE(oled_t * oled)                // the same text in the compressed font
+{
+    oled_SetFont(oled, &font12x16RLE);
+    oled_DispString(oled, 0, 0, "0123456789\nABCDEFGHIJ\nKLMNOPQRST\nabcdefghij");
+    oled_SetFont(oled, &font);
+}
+
+void RunStringSmall(oled_t * oled)              // a full screen of text in the 6x8 font
+{
+    oled_SetFont(oled, &font6x8);
+    oled_DispString(oled, 0, 0, "0123456789ABCDEFGHIJK\nLMNOPQRSTUVWXYZabcdef\nghijklmnopqrstuvwxyz!\n\"#$%&'()*+,-./:;<=>?@\n[\\]^_`{|}~ 0123456789\nABCDEFGHIJKLMNOPQRSTU\nVWXYZabcdefghijklmnop\nqrstuvwxyz 0123456789");
+    oled_SetFont(oled, &font);
+}
+
+void RunBitmap(oled_t * oled)                   // MIT logo from main.c
+{
+    oled_DispBitmap(oled, 32, 13, MIT_xbm, MIT_WIDTH, MIT_HEIGHT);
+}
+
+void RunPageBitmap(oled_t * oled)               // the same logo in GRAM format, page aligned and not
+{
+    oled_DispPageBitmap(oled, 0, 16, MIT_page, MIT_WIDTH, MIT_HEIGHT);
+    oled_DispPageBitmap(oled, 64, 13, MIT_page, MIT_WIDTH, MIT_HEIGHT);
+}
+
+void RunRLEBitmap(oled_t * oled)                // the same logo compressed
+{
+    oled_DispRLEBitmap(oled, 0, 16, MIT_compressed, MIT_WIDTH, MIT_HEIGHT);
+    oled_DispRLEBitmap(oled, 64, 13, MIT_compressed, MIT_WIDTH, MIT_HEIGHT);
+}
+
+void RunInvertRect(oled_t * oled)               // a highlighted menu item
+{
+    oled_InvertRect(oled, 0, 19, 127, 35);
+}
+
+void RunXorCursor(oled_t * oled)                // a cursor drawn and erased over a full screen of text
+{
+    oled_DispString(oled, 0, 0, "0123456789\nABCDEFGHIJ\nKLMNOPQRST\nabcdefghij");
+    oled_Flush(oled);
+    memset(&i2cOledStats, 0, sizeof(i2cOledStats));     // count the cursor only
+    oled_SetRasterOp(oled, OLED_ROP_XOR);
+    oled_FillRect(oled, 60, 20, 61, 35);
+    oled_FillRect(oled, 60, 20, 61, 35);
+    oled_SetRasterOp(oled, OLED_ROP_COPY);
+}
+
+void RunViewport(oled_t * oled)                 // a widget redrawn inside its viewport
+{
+    oled_PushClip(oled, 64, 16, 127, 47);
+    oled_Clear(oled);
+    oled_DrawCircle(oled, 32, 32, 30);
+    oled_DispString(oled, 8, 8, "42");
+    oled_PopClip(oled);
+}
+
+void RunClear(oled_t * oled)
+{
+    oled_Clear(oled);
+}
+
+const workload_t workloads[] = {
+    {"DrawPixel", RunPixel},
+    {"DrawLine", RunLines},
+    {"DrawTrend", RunTrend},
+    {"DrawLineHV", RunHVLines},
+    {"DrawRect", RunRect},
+    {"DrawRoundedRect", RunRoundedRect},
+    {"FillRect", RunFillRect},
+    {"FillRoundedRect", RunFillRoundedRect},
+    {"DrawCircle", RunCircle},
+    {"FillCircle", RunFillCircle},
+    {"DrawArc", RunArc},
+    {"DrawPie", RunPie},
+    {"DrawArcAngle", RunArcAngle},
+    {"DrawPieAngle", RunPieAngle},
+    {"FillTriangle", RunFillTriangle},
+    {"DrawTriangle", RunDrawTriangle},
+    {"FillPolygon", RunFillPolygon},
+    {"DrawEllipse", RunEllipse},
+    {"FillEllipse", RunFillEllipse},
+    {"DrawPoint", RunPoint},
+    {"DispChar", RunChar},
+    {"DispString", RunString},
+    {"DispStringProp", RunStringProp},
+    {"DispStringRLE", RunStringRLE},
+    {"DispStringSmall", RunStringSmall},
+    {"DispBitmap", RunBitmap},
+    {"DispPageBitmap", RunPageBitmap},
+    {"DispRLEBitmap", RunRLEBitmap},
+    {"InvertRect", RunInvertRect},
+    {"XorCursor", RunXorCursor},
+    {"Viewport", RunViewport},
+    {"Clear", RunClear},
+};
+
+oled_t oled;
+oled_i2c_t i2c;
+
+//========================================
+// Measure()
+// this function runs a workload on a cleared
+// display and returns the bus statistics of
+// the workload alone
+//========================================
+i2c_oled_stats_t Measure(const workload_t * w, uint8 updateMode)
+{
+    I2C_OLED_Reset();
+    oled_Init(&oled, oled_I2CTransport(&i2c, 0x3C, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte), updateMode);
+    oled_Clear(&oled);
+    oled_Flush(&oled);
+    memset(&i2cOledStats, 0, sizeof(i2cOledStats));
+    w->Run(&oled);
+    oled_Flush(&oled);
+    return i2cOledStats;
+}
+
+//========================================
+// Baseline()
+// this function looks up the bytes a workload
+// put on the bus in a previous output of bench
+//
+// Returns:
+//     bytes, or -1 if the workload is not listed
+//========================================
+long Baseline(FILE * f, const char * name, const char * mode)
+{
+    char line[256], n[64], m[64];
+    long transactions, bytes;
+    rewind(f);
+    while (fgets(line, sizeof(line), f) != NULL){
+        if (line[0] == '#') continue;
+        if (sscanf(line, "%63s %63s %ld %ld", n, m, &transactions, &bytes) != 4) continue;
+        if ((strcmp(n, name) == 0) && (strcmp(m, mode) == 0)) return bytes;
+    }
+    return -1;
+}
+
+//========================================
+// main
+//========================================
+int main(int argc, char ** argv)
+{
+    FILE * baseline = NULL;
+    int failed = 0;
+    const char * modes[2] = {"immediate", "deferred"};
+    const double rates[3] = {100e3, 400e3, 1e6};
+
+    if (argc > 1){
+        baseline = fopen(argv[1], "r");
+        if (baseline == NULL){
+            printf("could not read %s\n", argv[1]);
+            return 2;
+        }
+    }
+
+    printf("# %-16s %-10s %12s %8s %7s %7s %10s %10s %10s\n", "workload", "mode", "transactions", "bytes", "starts", "stops", "ms@100k", "ms@400k", "ms@1M");
+    for (int i=0; i<(int)(sizeof(workloads)/sizeof(workloads[0])); i++){
+        for (int m=0; m<2; m++){
+            i2c_oled_stats_t s = Measure(&workloads[i], m == 0 ? OLED_UPDATE_IMMEDIATE : OLED_UPDATE_DEFERRED);
+            double bits = (double)s.bytes*BITS_PER_BYTE + (double)(s.starts + s.stops)*BITS_PER_CONDITION;
+            printf("  %-16s %-10s %12u %8u %7u %7u", workloads[i].name, modes[m], s.starts, s.bytes, s.starts, s.stops);
+            for (int r=0; r<3; r++){
+                printf(" %10.2f", 1000.0*bits/rates[r]);
+            }
+            if (baseline != NULL){
+                long b = Baseline(baseline, workloads[i].name, modes[m]);
+                if ((b >= 0) && ((long)s.bytes > b)){
+                    printf("  REGRESSION (baseline %ld bytes)", b);
+                    failed = 1;
+                }
+            }
+            printf("\n");
+        }
+    }
+    if (baseline != NULL) fclose(baseline);
+    return failed;
+}
+
+//========================================
+// END OF FILE
+//========================================
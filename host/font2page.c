@@ -0,0 +1,430 @@
+//======================================
+// include
+//======================================
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "rle.h"
+
+//======================================
+// font2page
+// generates font_t tables (characters ' ' to '~'
+// in GRAM format: (height+7)/8 pages, each page
+// one byte per column, bit 0 = top pixel) from
+// the source of a font, which is one of:
+//     - a directory of .xbm files, one per
+//       character (font/: A.xbm, _a.xbm,
+//       ampersand.xbm, ..., see Name())
+//     - a .bdf file
+//     - a table of .xbm format characters
+//       (.width = 12, .height = 16, .characters =
+//       {{0x00, ...}, ...})
+//
+// usage: font2page source name[:WxH][:prop][:rle] ... > font.c
+// prints one font_t per name given. By default
+// the characters keep the size of the source.
+// With :WxH they are scaled to W by H pixels.
+// With :prop the font is made proportional:
+// blank columns on both sides of each character
+// are removed and SPACING() columns added on its
+// right. With :rle each character is compressed
+// (FONT_RLE)
+//======================================
+
+#define CHARACTERS 95                               // characters ' ' to '~'
+#define MAX_SIZE 64                                 // largest width and height of a character
+#define SPACING(width) (((width) + 5)/6)            // blank columns to the right of each character of a proportional font (2 for 12 pixel wide fonts)
+#define MAX_TEXT 1048576
+
+//======================================
+// font struct
+//======================================
+typedef struct {
+    int width, height;                              // size of the characters
+    unsigned char pixels[CHARACTERS][MAX_SIZE][MAX_SIZE];   // pixels[i][y][x], 1 = pixel on
+} font_t;
+
+//========================================
+// ReadText()
+// this function reads a whole text file
+//
+// Returns:
+//     pointer to the text (static), NULL on error
+//========================================
+char * ReadText(const char * path)
+{
+    static char text[MAX_TEXT];
+    FILE * f = fopen(path, "r");
+    if (f == NULL) return NULL;
+    size_t len = fread(text, 1, sizeof(text) - 1, f);
+    fclose(f);
+    text[len] = '\0';
+    return text;
+}
+
+//========================================
+// Name()
+// this function returns the name of the .xbm
+// file of character c in font/ (without the
+// extension): digits and capitals are named
+// after themselves, small letters are prefixed
+// with '_', punctuation is spelled out
+//========================================
+const char * Name(char c)
+{
+    static const char * punctuation[] = {
+        " space", "!exclamation_mark", "\"quotation_mark", "#number", "$dollar", "%percent", "&ampersand", "'single_quote",
+        "(parenthesisL", ")parenthesisR", "*asterisk", "+plus", ",comma", "-hyphen", ".period", "/forwardslash",
+        ":colon", ";semicolon", "<less_then", "=equals", ">greater_than", "?question_mark", "@at", "[square_bracketL",
+        "\\backslash", "]square_bracketR", "^caret", "_underscore", "`grave_accent", "{curly_braceL", "|vertical_bar",
+        "}curly_braceR", "~tilde"
+    };
+    static char name[3];
+    if (isdigit((unsigned char)c) || isupper((unsigned char)c)){
+        name[0] = c;
+        name[1] = '\0';
+        return name;
+    }
+    if (islower((unsigned char)c)){
+        name[0] = '_';
+        name[1] = c;
+        name[2] = '\0';
+        return name;
+    }
+    for (int i=0; i<(int)(sizeof(punctuation)/sizeof(punctuation[0])); i++){
+        if (punctuation[i][0] == c) return punctuation[i] + 1;
+    }
+    return "";
+}
+
+//========================================
+// ReadTable()
+// this function reads a table of .xbm format
+// characters (rows of pixels, bit 0 = leftmost
+// pixel)
+//
+// Returns:
+//     0 on success, -1 on error
+//========================================
+int ReadTable(const char * path, font_t * font)
+{
+    char * text = ReadText(path);
+    if (text == NULL) return -1;
+    char * w = strstr(text, ".width");              // ".width = 12"
+    char * h = strstr(text, ".height");
+    char * c = strstr(text, ".characters");
+    if ((w == NULL) || (h == NULL) || (c == NULL)) return -1;
+    font->width = atoi(strchr(w, '=') + 1);
+    font->height = atoi(strchr(h, '=') + 1);
+    if ((font->width <= 0) || (font->width > MAX_SIZE) || (font->height <= 0) || (font->height > MAX_SIZE)) return -1;
+
+    int stride = (font->width + 7)/8;
+    int depth = 0, i = -1, n = 0;
+    while (*c != '\0'){
+        if ((c[0] == '/') && (c[1] == '/')){        // comment (may hold braces, e.g. "{")
+            c = strpbrk(c, "\r\n");
+            if (c == NULL) break;
+        }
+        else if (*c == '{'){
+            if (++depth == 2){                      // start of a character
+                if (++i >= CHARACTERS) return -1;
+                n = 0;
+            }
+            c++;
+        }
+        else if (*c == '}'){
+            if (--depth == 0) break;                // end of the table
+            c++;
+        }
+        else if ((depth == 2) && (c[0] == '0') && (c[1] == 'x')){
+            int byte = (int)strtol(c, &c, 16);
+            for (int k=0; k<8; k++){
+                int x = 8*(n % stride) + k, y = n / stride;
+                if ((x < font->width) && (y < font->height)) font->pixels[i][y][x] = (byte >> k) & 0x01;
+            }
+            n++;
+        }
+        else {
+            c++;
+        }
+    }
+    return (i == CHARACTERS - 1) ? 0 : -1;
+}
+
+//========================================
+// ReadDirectory()
+// this function reads one .xbm file per
+// character. The font is as large as the
+// largest character; smaller characters are
+// placed in its top left corner. Missing
+// characters are left blank
+//
+// Returns:
+//     0 on success, -1 on error
+//========================================
+int ReadDirectory(const char * dir, font_t * font)
+{
+    char path[1024];
+    int found = 0;
+    font->width = 0;
+    font->height = 0;
+    for (int i=0; i<CHARACTERS; i++){
+        snprintf(path, sizeof(path), "%s/%s.xbm", dir, Name(' ' + i));
+        char * text = ReadText(path);
+        if (text == NULL) continue;
+        char * w = strstr(text, "_width");          // "#define name_width 12"
+        char * h = strstr(text, "_height");
+        char * c = strchr(text, '{');               // start of the pixel bytes
+        if ((w == NULL) || (h == NULL) || (c == NULL)) return -1;
+        int width = atoi(w + 6), height = atoi(h + 7);
+        if ((width <= 0) || (width > MAX_SIZE) || (height <= 0) || (height > MAX_SIZE)) return -1;
+        int stride = (width + 7)/8;
+        for (int n=0; n<stride*height; n++){
+            if ((c = strstr(c, "0x")) == NULL) return -1;
+            int byte = (int)strtol(c, &c, 16);
+            for (int k=0; k<8; k++){
+                int x = 8*(n % stride) + k;
+                if (x < width) font->pixels[i][n / stride][x] = (byte >> k) & 0x01;
+            }
+        }
+        if (width > font->width) font->width = width;
+        if (height > font->height) font->height = height;
+        found++;
+    }
+    return (found > 0) ? 0 : -1;
+}
+
+//========================================
+// ReadBDF()
+// this function reads the characters ' ' to '~'
+// of a .bdf font. The font is as large as its
+// FONTBOUNDINGBOX; each character is placed in
+// it by its BBX (missing characters are left
+// blank)
+//
+// Returns:
+//     0 on success, -1 on error
+//========================================
+int ReadBDF(const char * path, font_t * font)
+{
+    char * text = ReadText(path);
+    if (text == NULL) return -1;
+    int fbbX, fbbY;                                 // offset of the bounding box's lower left corner from the origin
+    char * line = strstr(text, "FONTBOUNDINGBOX");
+    if ((line == NULL) || (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &font->width, &font->height, &fbbX, &fbbY) != 4)) return -1;
+    if ((font->width <= 0) || (font->width > MAX_SIZE) || (font->height <= 0) || (font->height > MAX_SIZE)) return -1;
+
+    char * c = text;
+    while ((c = strstr(c, "STARTCHAR")) != NULL){
+        int encoding = -1, w = 0, h = 0, xo = 0, yo = 0;
+        char * e = strstr(c, "ENCODING");
+        char * b = strstr(c, "BBX");
+        char * bitmap = strstr(c, "BITMAP");
+        if ((e == NULL) || (b == NULL) || (bitmap == NULL)) return -1;
+        sscanf(e, "ENCODING %d", &encoding);
+        sscanf(b, "BBX %d %d %d %d", &w, &h, &xo, &yo);
+        c = bitmap + 6;
+        int top = (font->height + fbbY) - (yo + h); // row of the font the character's top row lands on
+        int left = xo - fbbX;
+        for (int y=0; y<h; y++){                    // one line of hex digits per row, most significant bit = leftmost pixel
+            while (isspace((unsigned char)*c)) c++;
+            for (int x=0; (x < w) && isxdigit((unsigned char)c[x/4]); x++){
+                int digit = isdigit((unsigned char)c[x/4]) ? c[x/4] - '0' : tolower((unsigned char)c[x/4]) - 'a' + 10;
+                int fx = left + x, fy = top + y;
+                if ((encoding >= ' ') && (encoding <= '~') && (fx >= 0) && (fx < font->width) && (fy >= 0) && (fy < font->height)){
+                    font->pixels[encoding - ' '][fy][fx] = (digit >> (3 - x%4)) & 0x01;
+                }
+            }
+            while ((*c != '\0') && !isspace((unsigned char)*c)) c++;
+        }
+    }
+    return 0;
+}
+
+//========================================
+// Scale()
+// this function scales the characters of src
+// to width by height pixels (each pixel takes
+// the source pixel under its center)
+//========================================
+void Scale(const font_t * src, font_t * dst, int width, int height)
+{
+    dst->width = width;
+    dst->height = height;
+    for (int i=0; i<CHARACTERS; i++){
+        for (int y=0; y<height; y++){
+            for (int x=0; x<width; x++){
+                dst->pixels[i][y][x] = src->pixels[i][(2*y + 1)*src->height/(2*height)][(2*x + 1)*src->width/(2*width)];
+            }
+        }
+    }
+}
+
+//========================================
+// Column()
+// this function returns page p of column x of
+// character i (one byte, bit 0 = top pixel)
+//========================================
+unsigned char Column(const font_t * font, int i, int p, int x)
+{
+    unsigned char col = 0;
+    for (int k=0; k<8; k++){                        // gather the 8 rows of the page in this column
+        int y = 8*p + k;
+        if (y >= font->height) break;
+        col |= font->pixels[i][y][x] << k;
+    }
+    return col;
+}
+
+//========================================
+// PrintFont()
+// this function prints the font_t tables of
+// a font. Characters are made of columns
+// x0[i] to x0[i]+widths[i]-1 of the font's
+// characters (columns past its width are
+// blank), compressed one by one if compress
+// is 1
+//========================================
+void PrintFont(const font_t * font, const char * name, const char * title, const int * x0, const int * widths, int compress)
+{
+    static unsigned char data[CHARACTERS][2*MAX_SIZE*MAX_SIZE/8];   // bytes of each character as stored in the font
+    int sizes[CHARACTERS];
+    int pages = (font->height + 7)/8;
+    for (int i=0; i<CHARACTERS; i++){
+        unsigned char page[2*MAX_SIZE*MAX_SIZE/8];
+        int n = widths[i]*pages;
+        for (int j=0; j<n; j++){
+            int p = j / widths[i], x = x0[i] + j % widths[i];
+            page[j] = (x < font->width) ? Column(font, i, p, x) : 0x00;
+        }
+        if (compress){
+            sizes[i] = rle_Encode(page, n, data[i]);
+        }
+        else {
+            memcpy(data[i], page, n);
+            sizes[i] = n;
+        }
+    }
+
+    printf("//======================================\n");
+    printf("// %s\n", title);
+    printf("//======================================\n");
+    printf("static const uint8 %sWidths[%d] = {", name, CHARACTERS);
+    for (int i=0; i<CHARACTERS; i++){
+        printf("%s%d%s", (i % 16 == 0) ? "\n    " : " ", widths[i], (i == CHARACTERS - 1) ? "" : ",");
+    }
+    printf("\n};\n\n");
+    printf("static const uint16 %sOffsets[%d] = {", name, CHARACTERS);
+    int offset = 0;
+    for (int i=0; i<CHARACTERS; i++){
+        printf("%s%d%s", (i % 12 == 0) ? "\n    " : " ", offset, (i == CHARACTERS - 1) ? "" : ",");
+        offset += sizes[i];
+    }
+    printf("\n};\n\n");
+    printf("static const uint8 %sBitmaps[%d] = {\n", name, offset);
+    for (int i=0; i<CHARACTERS; i++){
+        int n = sizes[i];
+        for (int j=0; j<n; j++){
+            int last = (i == CHARACTERS - 1) && (j == n - 1);
+            printf("%s0x%02x%s", (j % 12 == 0) ? "    " : " ", data[i][j], last ? "" : ",");
+            if ((j % 12 == 11) || (j == n - 1)){
+                if (j < 12) printf("%*s// \"%c\"%s", 5 + 6*(11 - j), "", ' ' + i, (i == 0) ? " (space)" : "");
+                printf("\n");
+            }
+        }
+    }
+    printf("};\n\n");
+    printf("const font_t %s = {.encoding = %s, .height = %d, .first = ' ', .last = '~', .widths = %sWidths, .offsets = %sOffsets, .bitmaps = %sBitmaps};\n\n", name, compress ? "FONT_RLE" : "FONT_RAW", font->height, name, name, name);
+}
+
+//========================================
+// main
+//========================================
+int main(int argc, char ** argv)
+{
+    static font_t source, font;
+    int x0[CHARACTERS], widths[CHARACTERS];
+    char title[128], name[64];
+    struct stat st;
+
+    if (argc < 3){
+        fprintf(stderr, "usage: font2page source name[:WxH][:prop][:rle] ...\n");
+        return 2;
+    }
+    int error;
+    const char * ext = strrchr(argv[1], '.');
+    if ((stat(argv[1], &st) == 0) && S_ISDIR(st.st_mode)) error = ReadDirectory(argv[1], &source);
+    else if ((ext != NULL) && (strcmp(ext, ".bdf") == 0)) error = ReadBDF(argv[1], &source);
+    else error = ReadTable(argv[1], &source);
+    if (error < 0){
+        fprintf(stderr, "font2page: could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    printf("//======================================\n");
+    printf("// fonts in GRAM format (generated by\n");
+    printf("// host/font2page, do not edit: run\n");
+    printf("// \"make -C host fonts\")\n");
+    printf("//======================================\n");
+    printf("#include \"font.h\"\n\n");
+
+    for (int a=2; a<argc; a++){
+        snprintf(name, sizeof(name), "%s", argv[a]);
+        char * options = strchr(name, ':');
+        int prop = 0, compress = 0, width = source.width, height = source.height;
+        if (options != NULL){
+            prop = (strstr(options, ":prop") != NULL);
+            compress = (strstr(options, ":rle") != NULL);
+            for (char * o=options; o!=NULL; o=strchr(o + 1, ':')){
+                if (isdigit((unsigned char)o[1])) sscanf(o + 1, "%dx%d", &width, &height);
+            }
+            *options = '\0';
+        }
+        if ((width <= 0) || (width > MAX_SIZE) || (height <= 0) || (height > MAX_SIZE)){
+            fprintf(stderr, "font2page: bad size for %s\n", name);
+            return 1;
+        }
+        Scale(&source, &font, width, height);
+
+        if (prop){
+            for (int i=0; i<CHARACTERS; i++){       // columns holding pixels of the character
+                int left = width, right = -1;
+                for (int x=0; x<width; x++){
+                    for (int p=0; p<(height + 7)/8; p++){
+                        if (Column(&font, i, p, x) == 0) continue;
+                        if (x < left) left = x;
+                        right = x;
+                    }
+                }
+                if (right < 0){                     // blank character (space)
+                    x0[i] = 0;
+                    widths[i] = width/2;
+                }
+                else {
+                    x0[i] = left;
+                    widths[i] = right - left + 1 + SPACING(width);
+                }
+            }
+            snprintf(title, sizeof(title), "%dx%d font, proportional%s", width, height, compress ? ", compressed" : "");
+        }
+        else {
+            for (int i=0; i<CHARACTERS; i++){       // every character as wide as the font
+                x0[i] = 0;
+                widths[i] = width;
+            }
+            snprintf(title, sizeof(title), "%dx%d font, every character %d pixels wide%s", width, height, width, compress ? ", compressed" : "");
+        }
+        PrintFont(&font, name, title, x0, widths, compress);
+    }
+
+    printf("//========================================\n");
+    printf("// END OF FILE\n");
+    printf("//========================================\n");
+    return 0;
+}
+
+//========================================
+// END OF FILE
+//========================================
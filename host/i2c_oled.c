@@ -0,0 +1,102 @@
+//======================================
+// include
+//======================================
+#include "i2c_oled.h"
+
+//======================================
+// emulated bus
+//======================================
+ssd1306_t i2cOledPanel;
+i2c_oled_stats_t i2cOledStats;
+uint8 i2cOledLatency = 0;
+static uint8 busyPolls = 0;                       // I2C_OLED_MasterStatus() calls left before the current buffer transfer completes
+
+//========================================
+// I2C_OLED_Reset()
+// this function resets the emulated display
+// (slave address 0x3C) and the bus statistics
+//========================================
+void I2C_OLED_Reset(void)
+{
+    ssd1306_Init(&i2cOledPanel, 0x3C);
+    i2cOledStats.starts = 0;
+    i2cOledStats.stops = 0;
+    i2cOledStats.bytes = 0;
+    i2cOledStats.buffers = 0;
+    i2cOledStats.polls = 0;
+    busyPolls = 0;
+}
+
+//========================================
+// I2C_OLED_MasterSendStart()
+// generates a Start condition and sends the
+// slave address with the read/write bit
+//========================================
+uint8 I2C_OLED_MasterSendStart(uint8 slaveAddress, uint8 R_nW)
+{
+    i2cOledStats.starts++;
+    i2cOledStats.bytes++;                   // slave address byte
+    ssd1306_Start(&i2cOledPanel, slaveAddress, R_nW);
+    return 0;
+}
+
+//========================================
+// I2C_OLED_MasterSendStop()
+// generates a Stop condition
+//========================================
+uint8 I2C_OLED_MasterSendStop(void)
+{
+    i2cOledStats.stops++;
+    ssd1306_Stop(&i2cOledPanel);
+    return 0;
+}
+
+//========================================
+// I2C_OLED_MasterWriteByte()
+// sends one byte
+//========================================
+uint8 I2C_OLED_MasterWriteByte(uint8 theByte)
+{
+    i2cOledStats.bytes++;
+    ssd1306_Write(&i2cOledPanel, theByte);
+    return 0;
+}
+
+//========================================
+// I2C_OLED_MasterWriteBuf()
+// sends a whole buffer (Start, slave address,
+// the bytes, Stop). The bytes reach the display
+// at once but the transfer is reported in 
+// progress for i2cOledLatency status calls
+//========================================
+uint8 I2C_OLED_MasterWriteBuf(uint8 slaveAddress, uint8 * wrData, uint8 cnt, uint8 mode)
+{
+    (void)mode;
+    if (busyPolls > 0) return 0x02;         // I2C_OLED_MSTR_BUS_BUSY
+    i2cOledStats.buffers++;
+    I2C_OLED_MasterSendStart(slaveAddress, 0x00);
+    for (int i=0; i<cnt; i++){
+        I2C_OLED_MasterWriteByte(wrData[i]);
+    }
+    I2C_OLED_MasterSendStop();
+    busyPolls = i2cOledLatency;
+    return 0;
+}
+
+//========================================
+// I2C_OLED_MasterStatus()
+// returns the status of the buffer transfer
+//========================================
+uint8 I2C_OLED_MasterStatus(void)
+{
+    if (busyPolls > 0){
+        busyPolls--;
+        i2cOledStats.polls++;
+        return I2C_OLED_MSTAT_XFER_INP;
+    }
+    return I2C_OLED_MSTAT_WR_CMPLT;
+}
+
+//========================================
+// END OF FILE
+//========================================
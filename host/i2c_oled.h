@@ -0,0 +1,50 @@
+#ifndef _I2C_OLED_H
+#define _I2C_OLED_H
+
+//======================================
+// include
+//======================================
+#include "project.h"
+#include "ssd1306_emu.h"
+
+//======================================
+// host stand-in for the I2C_OLED component:
+// the master API functions the library uses,
+// connected to an emulated SSD1306
+//======================================
+#define I2C_OLED_MSTAT_WR_CMPLT 0x02    // write transfer complete
+#define I2C_OLED_MSTAT_XFER_INP 0x04    // transfer in progress
+
+//======================================
+// bus statistics struct
+//======================================
+typedef struct {
+    uint32 starts;          // Start conditions (including repeated Starts)
+    uint32 stops;           // Stop conditions
+    uint32 bytes;           // bytes on the bus, slave address bytes included
+    uint32 buffers;         // transfers started with I2C_OLED_MasterWriteBuf()
+    uint32 polls;           // I2C_OLED_MasterStatus() calls that returned "transfer in progress"
+} i2c_oled_stats_t;
+
+extern ssd1306_t i2cOledPanel;              // the display on the bus
+extern i2c_oled_stats_t i2cOledStats;       // traffic since the last I2C_OLED_Reset()
+extern uint8 i2cOledLatency;                // number of I2C_OLED_MasterStatus() calls an I2C_OLED_MasterWriteBuf() transfer stays in progress
+
+//========================================
+// I2C_OLED_Reset()
+// this function resets the emulated display
+// (slave address 0x3C) and the bus statistics
+//========================================
+void I2C_OLED_Reset(void);
+
+uint8 I2C_OLED_MasterSendStart(uint8 slaveAddress, uint8 R_nW);
+uint8 I2C_OLED_MasterSendStop(void);
+uint8 I2C_OLED_MasterWriteByte(uint8 theByte);
+uint8 I2C_OLED_MasterWriteBuf(uint8 slaveAddress, uint8 * wrData, uint8 cnt, uint8 mode);
+uint8 I2C_OLED_MasterStatus(void);
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
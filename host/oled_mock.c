@@ -0,0 +1,151 @@
+//======================================
+// include
+//======================================
+#include "oled_mock.h"
+
+//======================================
+// private function declarations
+//======================================
+uint8 MockWriteCmds(void * bus, const uint8 * cmds, uint8 count);
+uint16 MockWriteData(void * bus, const uint8 * data, uint16 count);
+void MockFlush(void * bus);
+uint8 MockBusy(void * bus);
+
+//========================================
+// oled_MockTransport()
+// this function sets up a transport that only
+// counts what the library sends, so the library
+// can be run and measured on the host
+//
+// Parameters:
+//     mock - pointer to a oled_mock_t structure
+//     capacity - most bytes one transfer can hold
+//                (0 for no limit)
+//     latency - number of Busy() calls each transfer
+//               takes to complete (0 for a blocking
+//               transport)
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_MockTransport(oled_mock_t * mock, uint16 capacity, uint8 latency)
+{
+    mock->transport.bus = mock;
+    mock->transport.WriteCmds = MockWriteCmds;
+    mock->transport.WriteData = MockWriteData;
+    mock->transport.Flush = MockFlush;
+    mock->transport.Busy = NULL;
+    if (latency > 0) mock->transport.Busy = MockBusy;
+    mock->transport.windowCost = OLED_MOCK_WINDOW_COST;
+    mock->capacity = capacity;
+    mock->latency = latency;
+    mock->ticks = 0;
+    mock->count = 0;
+    oled_MockReset(mock);
+    return &mock->transport;
+}
+
+//========================================
+// oled_MockReset()
+// this function clears the counters
+//
+// Parameters:
+//     mock - pointer to a oled_mock_t structure
+//========================================
+void oled_MockReset(oled_mock_t * mock)
+{
+    mock->transfers = 0;
+    mock->cmdBytes = 0;
+    mock->dataBytes = 0;
+    mock->polls = 0;
+    mock->errors = 0;
+}
+
+//======================================
+// MockWriteCmds()
+// this function counts count command bytes,
+// all of them or none if they do not fit in
+// the transfer
+//
+// Parameters:
+//     bus - pointer to a oled_mock_t structure
+//     cmds - commands and their parameters
+//     count - number of bytes in cmds
+//
+// Returns:
+//     count, or 0 if the commands were refused
+//======================================
+uint8 MockWriteCmds(void * bus, const uint8 * cmds, uint8 count)
+{
+    oled_mock_t * mock = bus;
+    (void)cmds;
+    if (mock->ticks > 0) mock->errors++;        // the previous transfer has not completed
+    if ((mock->capacity > 0) && (count > mock->capacity - mock->count)) return 0;
+    mock->cmdBytes += count;
+    mock->count += count;
+    return count;
+}
+
+//======================================
+// MockWriteData()
+// this function counts as many of count
+// GRAM data bytes as fit in the transfer
+//
+// Parameters:
+//     bus - pointer to a oled_mock_t structure
+//     data - GRAM data
+//     count - number of bytes in data
+//
+// Returns:
+//     number of bytes taken
+//======================================
+uint16 MockWriteData(void * bus, const uint8 * data, uint16 count)
+{
+    oled_mock_t * mock = bus;
+    (void)data;
+    if (mock->ticks > 0) mock->errors++;        // the previous transfer has not completed
+    if (mock->capacity > 0){
+        if (mock->count >= mock->capacity) return 0;
+        if (count > mock->capacity - mock->count) count = mock->capacity - mock->count;
+    }
+    mock->dataBytes += count;
+    mock->count += count;
+    return count;
+}
+
+//======================================
+// MockFlush()
+// this function ends the transfer being built
+//
+// Parameters:
+//     bus - pointer to a oled_mock_t structure
+//======================================
+void MockFlush(void * bus)
+{
+    oled_mock_t * mock = bus;
+    if (mock->count == 0) return;
+    mock->count = 0;
+    mock->transfers++;
+    mock->ticks = mock->latency;
+}
+
+//======================================
+// MockBusy()
+// this function returns 1 for the first
+// latency calls after a transfer is flushed
+//
+// Parameters:
+//     bus - pointer to a oled_mock_t structure
+//======================================
+uint8 MockBusy(void * bus)
+{
+    oled_mock_t * mock = bus;
+    if (mock->ticks == 0) return 0;
+    mock->ticks--;
+    mock->polls++;
+    return 1;
+}
+
+//========================================
+// END OF FILE
+//========================================
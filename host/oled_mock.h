@@ -0,0 +1,63 @@
+#ifndef _OLED_MOCK_H
+#define _OLED_MOCK_H
+
+//======================================
+// include
+//======================================
+#include "project.h"
+#include "oled_transport.h"
+
+//======================================
+// mock transport settings
+//======================================
+#define OLED_MOCK_WINDOW_COST 6     // bus cost (in bytes) of opening a window: the 6 command bytes themselves
+
+//======================================
+// mock transport struct
+//======================================
+typedef struct {
+    oled_transport_t transport;     // transport handed to oled_Init()
+    uint16 capacity;                // most bytes (commands and data) one transfer can hold, 0 for no limit
+    uint8 latency;                  // number of Busy() calls a transfer stays "on the bus", 0 for a blocking transport
+    uint8 ticks;                    // Busy() calls left for the current transfer
+    uint16 count;                   // bytes in the transfer being built
+    uint32 transfers;               // number of transfers flushed
+    uint32 cmdBytes;                // number of command bytes sent
+    uint32 dataBytes;               // number of GRAM data bytes sent
+    uint32 polls;                   // number of Busy() calls that returned 1
+    uint32 errors;                  // number of writes made while a transfer was still on the bus
+} oled_mock_t;
+
+//========================================
+// oled_MockTransport()
+// this function sets up a transport that only
+// counts what the library sends, so the library
+// can be run and measured on the host
+//
+// Parameters:
+//     mock - pointer to a oled_mock_t structure
+//     capacity - most bytes one transfer can hold
+//                (0 for no limit)
+//     latency - number of Busy() calls each transfer
+//               takes to complete (0 for a blocking
+//               transport)
+//
+// Returns:
+//     pointer to the transport (to pass to oled_Init())
+//========================================
+oled_transport_t * oled_MockTransport(oled_mock_t * mock, uint16 capacity, uint8 latency);
+
+//========================================
+// oled_MockReset()
+// this function clears the counters
+//
+// Parameters:
+//     mock - pointer to a oled_mock_t structure
+//========================================
+void oled_MockReset(oled_mock_t * mock);
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
@@ -0,0 +1,23 @@
+#ifndef PROJECT_H
+#define PROJECT_H
+
+//======================================
+// host stand-in for the PSoC Creator generated
+// project.h: only the types the library uses
+//======================================
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef int8_t int8;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
@@ -0,0 +1,185 @@
+//======================================
+// include
+//======================================
+#include <stdio.h>
+#include <string.h>
+#include "oled.h"
+#include "oled_i2c.h"
+#include "i2c_oled.h"
+#include "oled_mock.h"
+#include "scenes.h"
+
+//======================================
+// render
+// draws each scene of main.c through every
+// way the library can update the display,
+// checks that the emulated display RAM ends
+// up byte-for-byte equal to GRAM, and saves
+// the display as <scene>.pbm. Each scene is
+// also flushed through the counting mock 
+// transport with a small transfer size and
+// some latency, which must send the same GRAM
+// data as a plain blocking transport
+//
+// usage: render [output directory]
+//======================================
+
+//======================================
+// update paths
+//======================================
+#define PATH_IMMEDIATE 0    // blocking I2C, every drawing function sends its changes
+#define PATH_DEFERRED 1     // blocking I2C, oled_Flush()
+#define PATH_SYNC 2         // blocking I2C, shadow buffer and oled_Sync() after a previous frame
+#define PATH_ASYNC 3        // interrupt driven I2C, oled_Flush()
+#define PATH_PRESENT 4      // interrupt driven I2C, back buffer and oled_Present()
+#define PATH_COUNT 5
+
+//======================================
+// mock transport (see MockRender())
+//======================================
+#define MOCK_CAPACITY 32    // bytes per transfer
+#define MOCK_LATENCY 3      // Busy() calls per transfer
+
+const char * pathNames[PATH_COUNT] = {"immediate", "deferred", "sync", "async", "present"};
+
+typedef struct {
+    const char * name;
+    void (*Draw)(oled_t * oled);
+} scene_t;
+
+const scene_t scenes[] = {
+    {"graphics", scene_Graphics},
+    {"gauges", scene_Gauges},
+    {"angles", scene_Angles},
+    {"rasterops", scene_RasterOps},
+    {"viewports", scene_Viewports},
+    {"polygons", scene_Polygons},
+    {"ellipses", scene_Ellipses},
+    {"backbuffer", scene_BackBuffer},
+    {"text", scene_Text},
+    {"textfill", scene_TextFill},
+    {"textprop", scene_TextProp},
+    {"fonts", scene_Fonts},
+    {"bitmap", scene_Bitmap},
+    {"pagebitmap", scene_PageBitmap},
+    {"rle", scene_RLE},
+};
+
+oled_t oled;
+oled_i2c_t i2c;
+uint8 i2cBuf[OLED_I2C_BUF_SIZE];
+oled_mock_t mock;
+uint8 shadow[OLED_GRAM_SIZE];
+uint8 back[OLED_GRAM_SIZE];
+
+//========================================
+// Render()
+// this function draws a scene through one
+// update path on a freshly reset display.
+// Bus statistics only count the scene
+// Returns:
+//     1 if display RAM matches GRAM, 0 otherwise
+//========================================
+int Render(const scene_t * scene, int path)
+{
+    oled_transport_t * t;
+    I2C_OLED_Reset();
+    i2cOledLatency = 3;
+    if ((path == PATH_ASYNC) || (path == PATH_PRESENT)){
+        t = oled_I2CAsyncTransport(&i2c, 0x3C, i2cBuf, sizeof(i2cBuf), I2C_OLED_MasterWriteBuf, I2C_OLED_MasterStatus);
+    }
+    else {
+        t = oled_I2CTransport(&i2c, 0x3C, I2C_OLED_MasterSendStart, I2C_OLED_MasterSendStop, I2C_OLED_MasterWriteByte);
+    }
+    oled_Init(&oled, t, path == PATH_IMMEDIATE ? OLED_UPDATE_IMMEDIATE : OLED_UPDATE_DEFERRED);
+
+    if (path == PATH_SYNC){                         // the display already shows another frame
+        oled_SetShadow(&oled, shadow);
+        scenes[0].Draw(&oled);
+        oled_Sync(&oled);
+        oled_Clear(&oled);
+    }
+    if (path == PATH_PRESENT) oled_SetBackBuffer(&oled, back);
+    while (oled_IsBusy(&oled));
+    memset(&i2cOledStats, 0, sizeof(i2cOledStats));
+
+    scene->Draw(&oled);
+
+    if ((path == PATH_DEFERRED) || (path == PATH_ASYNC)) oled_Flush(&oled);
+    if (path == PATH_SYNC) oled_Sync(&oled);
+    if (path == PATH_PRESENT) oled_Present(&oled);
+    while (oled_IsBusy(&oled));
+
+    return memcmp(i2cOledPanel.ram, oled.txGRAM, OLED_GRAM_SIZE) == 0;
+}
+
+//========================================
+// MockRender()
+// this function draws a scene through the
+// mock transport, returning the GRAM data 
+// bytes sent. With a latency each
+// transfer must be polled to completion
+// before the next one starts, and with a 
+// capacity no transfer may hold more than
+// that many data bytes
+//
+// Returns:
+//     GRAM data bytes sent, -1 if the mock 
+//     counted a transfer the library should
+//     not have made
+//========================================
+long MockRender(const scene_t * scene, uint8 updateMode, uint16 capacity, uint8 latency)
+{
+    oled_Init(&oled, oled_MockTransport(&mock, capacity, latency), updateMode);
+    while (oled_IsBusy(&oled));
+    oled_MockReset(&mock);
+
+    scene->Draw(&oled);
+    oled_Flush(&oled);
+    while (oled_IsBusy(&oled));
+
+    if (mock.errors != 0) return -1;                // a transfer began while the last was on the bus
+    if (mock.polls != mock.transfers*latency) return -1;    // a transfer was not waited for
+    if ((capacity > 0) && (mock.dataBytes > mock.transfers*capacity)) return -1;
+    return mock.dataBytes;
+}
+
+//========================================
+// main
+//========================================
+int main(int argc, char ** argv)
+{
+    const char * dir = (argc > 1) ? argv[1] : ".";
+    int failed = 0;
+    uint8 reference[OLED_GRAM_SIZE];
+    char path[256];
+
+    printf("%-10s %-10s %8s %7s %7s  %s\n", "scene", "path", "bytes", "starts", "errors", "result");
+    for (int s=0; s<(int)(sizeof(scenes)/sizeof(scenes[0])); s++){
+        for (int p=0; p<PATH_COUNT; p++){
+            int ok = Render(&scenes[s], p);
+            if (p == PATH_IMMEDIATE){               // every other path must produce what immediate updates produce
+                memcpy(reference, i2cOledPanel.ram, OLED_GRAM_SIZE);
+                snprintf(path, sizeof(path), "%s/%s.pbm", dir, scenes[s].name);
+                if (ssd1306_WritePBM(&i2cOledPanel, path) != 0) printf("could not write %s\n", path);
+            }
+            else if (memcmp(reference, i2cOledPanel.ram, OLED_GRAM_SIZE) != 0){
+                ok = 0;
+            }
+            if (i2cOledPanel.errors != 0) ok = 0;
+            printf("%-10s %-10s %8u %7u %7u  %s\n", scenes[s].name, pathNames[p], i2cOledStats.bytes, i2cOledStats.starts, i2cOledPanel.errors, ok ? "ok" : "MISMATCH");
+            if (!ok) failed = 1;
+        }
+        int ok = MockRender(&scenes[s], OLED_UPDATE_IMMEDIATE, MOCK_CAPACITY, MOCK_LATENCY) >= 0;    // pages queued while the bus is busy
+        long sent = MockRender(&scenes[s], OLED_UPDATE_DEFERRED, 0, 0);
+        long split = MockRender(&scenes[s], OLED_UPDATE_DEFERRED, MOCK_CAPACITY, MOCK_LATENCY);
+        if ((sent < 0) || (split != sent)) ok = 0;
+        printf("%-10s %-10s %8lu %7lu %7lu  %s\n", scenes[s].name, "mock", (unsigned long)(mock.cmdBytes + mock.dataBytes), (unsigned long)mock.transfers, (unsigned long)mock.errors, ok ? "ok" : "MISMATCH");
+        if (!ok) failed = 1;
+    }
+    return failed;
+}
+
+//========================================
+// END OF FILE
+//========================================
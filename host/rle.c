@@ -0,0 +1,62 @@
+//======================================
+// include
+//======================================
+#include "rle.h"
+
+//======================================
+// private function declarations
+//======================================
+int RunLength(const unsigned char * src, int count, int i);
+
+//========================================
+// rle_Encode()
+// this function compresses count bytes into
+// the packets oled_DispRLEBitmap() expands:
+// a control byte c followed by c+1 bytes
+// (c < 0x80), or by one byte repeated
+// (c & 0x7F)+2 times (c >= 0x80)
+//
+// Parameters:
+//     src - bytes to compress
+//     count - number of bytes
+//     dst - where to write the packets (at
+//           most count + (count+127)/128 bytes)
+//
+// Returns:
+//     number of bytes written to dst
+//========================================
+int rle_Encode(const unsigned char * src, int count, unsigned char * dst)
+{
+    int n = 0, i = 0;
+    while (i < count){
+        int run = RunLength(src, count, i);
+        if (run >= 3){                              // repeated byte (a run of 2 costs as much as 2 literal bytes)
+            dst[n++] = 0x80 | (run - 2);
+            dst[n++] = src[i];
+            i += run;
+            continue;
+        }
+        int start = i;                              // literal bytes up to the next run of 3 or more
+        while ((i < count) && (i - start < 128) && (RunLength(src, count, i) < 3)) i++;
+        dst[n++] = i - start - 1;
+        for (int j=start; j<i; j++) dst[n++] = src[j];
+    }
+    return n;
+}
+
+//========================================
+// RunLength()
+// this function returns how many times
+// src[i] is repeated from i on (at most 129,
+// the longest run a packet holds)
+//========================================
+int RunLength(const unsigned char * src, int count, int i)
+{
+    int run = 1;
+    while ((i + run < count) && (run < 129) && (src[i + run] == src[i])) run++;
+    return run;
+}
+
+//========================================
+// END OF FILE
+//========================================
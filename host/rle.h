@@ -0,0 +1,27 @@
+#ifndef _RLE_H
+#define _RLE_H
+
+//========================================
+// rle_Encode()
+// this function compresses count bytes into
+// the packets oled_DispRLEBitmap() expands:
+// a control byte c followed by c+1 bytes
+// (c < 0x80), or by one byte repeated
+// (c & 0x7F)+2 times (c >= 0x80)
+//
+// Parameters:
+//     src - bytes to compress
+//     count - number of bytes
+//     dst - where to write the packets (at
+//           most count + (count+127)/128 bytes)
+//
+// Returns:
+//     number of bytes written to dst
+//========================================
+int rle_Encode(const unsigned char * src, int count, unsigned char * dst);
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
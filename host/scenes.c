@@ -0,0 +1,349 @@
+//======================================
+// include
+//======================================
+#include "scenes.h"
+
+//======================================
+// MIT logo from main.c
+//======================================
+#include "mit.xbm"          // .xbm format
+#include "mit_pages.h"      // GRAM format (generated from mit.xbm by xbm2page)
+#include "mit_rle.h"        // compressed GRAM format (generated from mit.xbm by xbm2page -r)
+
+const unsigned char * MIT_xbm = MIT_bits;
+const unsigned char * MIT_page = MIT_pages;
+const unsigned char * MIT_compressed = MIT_rle;
+
+//========================================
+// scene_Graphics()
+// the shapes of DemoGraphics() side by side
+//========================================
+void scene_Graphics(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_SetPenSize(oled, 1);
+    oled_DrawLine(oled, 0, 0, 40, 20);
+    oled_DrawLine(oled, 0, 20, 40, 0);
+    oled_DrawRect(oled, 44, 0, 84, 20);
+    oled_FillRoundedRect(oled, 88, 0, 127, 20, 6);
+    oled_DrawCircle(oled, 20, 42, 18);
+    oled_DrawArc(oled, 64, 42, 18, 5, 8);
+    oled_DrawPie(oled, 106, 42, 18, 5, 8);
+    oled_FillCircle(oled, 64, 42, 8);
+}
+
+//========================================
+// scene_Gauges()
+// gauges and indicator dots drawn the way a
+// screen redrawn every frame would: the same
+// few circles over and over, with a span
+// cache (see oled_SetSpanCache())
+//========================================
+void scene_Gauges(oled_t * oled)
+{
+    static oled_span_cache_t cache[3];
+    oled_Clear(oled);
+    oled_SetSpanCache(oled, cache, 3);
+    for (int frame=0; frame<2; frame++){
+        for (int i=0; i<4; i++){
+            oled_SetPenSize(oled, 1);
+            oled_DrawArc(oled, 16 + 32*i, 20, 14, 4, 8);        // gauge
+            oled_DrawPie(oled, 16 + 32*i, 20, 9, 4 + i, 5 + i);  // needle
+            oled_SetPenSize(oled, 2);
+            oled_DrawPoint(oled, 16 + 32*i, 34);                // indicator dot
+            oled_DrawCircle(oled, 16 + 32*i, 50, 6);
+        }
+        oled_SetPenSize(oled, 0);
+        oled_FillCircle(oled, 120, -2, 30);                     // too large to cache
+    }
+    oled_SetSpanCache(oled, NULL, 0);
+    oled_SetPenSize(oled, 0);
+}
+
+//========================================
+// scene_Angles()
+// progress rings and gauge needles at angles
+// that are not multiples of 45 degrees
+//========================================
+void scene_Angles(oled_t * oled)
+{
+    oled_Clear(oled);
+    for (int i=0; i<3; i++){
+        oled_SetPenSize(oled, 1);
+        oled_DrawArcAngle(oled, 20 + 44*i, 20, 16, OLED_DEGREES(-90), OLED_DEGREES(-90 + 100 + 110*i));  // 28%, 58% and 86% rings
+        oled_SetPenSize(oled, 0);
+        oled_DrawArcAngle(oled, 20 + 44*i, 52, 18, OLED_DEGREES(150), OLED_DEGREES(30));               // gauge scale
+        oled_DrawPieAngle(oled, 20 + 44*i, 52, 16, OLED_DEGREES(170 + 60*i), OLED_DEGREES(176 + 60*i));    // needle
+    }
+    oled_DrawPieAngle(oled, 118, 20, 30, OLED_DEGREES(100), OLED_DEGREES(100));     // one turn, mostly off the display
+}
+
+//========================================
+// scene_RasterOps()
+// a cursor drawn with OLED_ROP_XOR and erased
+// by drawing it again, over shapes and text
+// combined with the other raster operations
+//========================================
+void scene_RasterOps(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_SetPenSize(oled, 0);
+    for (int x=0; x<OLED_WIDTH; x+=6) oled_DrawLine(oled, x, 0, x + 20, OLED_HEIGHT - 1);
+    oled_SetRasterOp(oled, OLED_ROP_AND_NOT);
+    oled_FillCircle(oled, 24, 32, 20);                  // hole in the pattern
+    oled_SetRasterOp(oled, OLED_ROP_OR);
+    oled_DispString(oled, 6, 24, "OR");
+    oled_SetRasterOp(oled, OLED_ROP_XOR);
+    oled_DispString(oled, 54, 3, "XOR");
+    oled_SetPenSize(oled, 1);
+    oled_DrawRect(oled, 50, 26, 120, 58);               // rubber band, pen wider than one pixel
+    oled_DrawLine(oled, 84, 30, 84, 54);                // cursor...
+    oled_DrawLine(oled, 72, 42, 96, 42);
+    oled_DrawLine(oled, 84, 30, 84, 54);                // ...erased
+    oled_DrawLine(oled, 72, 42, 96, 42);
+    oled_FillCircle(oled, 110, 10, 8);
+    oled_SetRasterOp(oled, OLED_ROP_COPY);
+    oled_SetPenSize(oled, 0);
+}
+
+//========================================
+// scene_Viewports()
+// two widgets redrawn inside their own
+// viewports (see oled_PushClip()): a gauge 
+// that overflows its panel and a list 
+// scrolled half a line, over a background 
+// that must not be drawn over
+//========================================
+void scene_Viewports(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_SetPenSize(oled, 0);
+    for (int x=0; x<OLED_WIDTH; x+=4) oled_DrawLine(oled, x, 0, OLED_WIDTH - 1 - x, OLED_HEIGHT - 1);
+    oled_PushClip(oled, 4, 4, 59, 59);                  // gauge panel
+    oled_Clear(oled);
+    oled_DrawRect(oled, 0, 0, 55, 55);
+    oled_SetPenSize(oled, 2);
+    oled_DrawArcAngle(oled, 28, 36, 30, OLED_DEGREES(180), OLED_DEGREES(0));
+    oled_SetPenSize(oled, 0);
+    oled_DrawPieAngle(oled, 28, 36, 26, OLED_DEGREES(300), OLED_DEGREES(306));
+    oled_PopClip(oled);
+    oled_PushClip(oled, 66, 10, 123, 53);               // list panel
+    oled_Clear(oled);
+    oled_SetFont(oled, &font6x8);
+    oled_DispString(oled, 2, -4, "Alpha\nBravo\nCharlie\nDelta\nEcho\nFoxtrot");
+    oled_PushClip(oled, 0, 20, 57, 27);                 // selected item, nested
+    oled_SetRasterOp(oled, OLED_ROP_XOR);
+    oled_FillRect(oled, -10, -10, 100, 100);
+    oled_SetRasterOp(oled, OLED_ROP_COPY);
+    oled_PopClip(oled);
+    oled_SetFont(oled, &font);
+    oled_PopClip(oled);
+}
+
+//========================================
+// scene_Polygons()
+// arrow icons, gauge needles and a star: 
+// filled triangles and polygons, concave and
+// partly off the display, and outlines drawn
+// with a wide pen
+//========================================
+void scene_Polygons(oled_t * oled)
+{
+    static const int16 arrow[] = {0, 4, 8, 4, 8, 0, 15, 7, 8, 14, 8, 10, 0, 10};
+    static const int16 star[] = {0, -20, 5, -7, 19, -6, 8, 3, 12, 16, 0, 8, -12, 16, -8, 3, -19, -6, -5, -7};
+    int16 points[20];
+    oled_Clear(oled);
+    oled_SetPenSize(oled, 0);
+    for (int i=0; i<4; i++){                            // arrow icons, one per direction
+        for (int k=0; k<7; k++){
+            int x = arrow[2*k], y = arrow[2*k + 1];
+            points[2*k] = 2 + 18*i + ((i == 0) ? x : (i == 1) ? 14 - x : (i == 2) ? y : 14 - y);
+            points[2*k + 1] = 2 + ((i < 2) ? y : (i == 2) ? x : 14 - x);
+        }
+        oled_FillPolygon(oled, points, 7);
+    }
+    oled_FillTriangle(oled, 4, 60, 40, 26, 12, 62);     // gauge needles
+    oled_FillTriangle(oled, 30, 60, 36, 58, 68, 40);
+    oled_DrawTriangle(oled, 44, 62, 56, 34, 70, 62);
+    for (int k=0; k<10; k++){                           // star, partly off the display
+        points[2*k] = 106 + star[2*k];
+        points[2*k + 1] = 48 + star[2*k + 1];
+    }
+    oled_FillPolygon(oled, points, 10);
+    oled_SetPenSize(oled, 1);
+    for (int k=0; k<10; k++) points[2*k] = 84 + star[2*k];
+    for (int k=0; k<10; k++) points[2*k + 1] = 16 + star[2*k + 1];
+    oled_DrawPolygon(oled, points, 10);
+    oled_SetPenSize(oled, 0);
+}
+
+//========================================
+// scene_Ellipses()
+// a row of rounded buttons, the selected one
+// inverted, and a button scrolled half out of
+// its panel, over ellipses filled, drawn with
+// a wide pen and partly off the display
+//========================================
+void scene_Ellipses(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_SetPenSize(oled, 0);
+    oled_FillEllipse(oled, 20, 44, 18, 10);
+    oled_DrawEllipse(oled, 20, 44, 18, 10);
+    oled_SetPenSize(oled, 1);
+    oled_DrawEllipse(oled, 64, 44, 22, 14);             // ring
+    oled_SetPenSize(oled, 0);
+    oled_DrawEllipse(oled, 64, 44, 4, 17);
+    oled_FillEllipse(oled, 110, 60, 30, 6);             // partly off the display
+    for (int i=0; i<4; i++){                            // buttons
+        oled_FillRoundedRect(oled, 2 + 36*i, 2, 33 + 36*i, 21, 6);
+    }
+    oled_SetRasterOp(oled, OLED_ROP_XOR);
+    oled_FillRoundedRect(oled, 40, 4, 67, 19, 4);       // selected button
+    oled_SetRasterOp(oled, OLED_ROP_COPY);
+    oled_PushClip(oled, 0, 24, 127, 63);                // a button scrolled half out of its panel
+    oled_FillRoundedRect(oled, 92, -10, 125, 20, 8);
+    oled_PopClip(oled);
+}
+
+//========================================
+// scene_BackBuffer()
+// an odd number of frames of a moving bar 
+// shown with oled_Present(), so that GRAM 
+// ends up in the other buffer, then double
+// buffering turned off and a marker drawn 
+// over the last frame, partly flushed on its
+// own. The top page is drawn on before
+// double buffering is turned off
+//========================================
+void scene_BackBuffer(oled_t * oled)
+{
+    static uint8 back[OLED_GRAM_SIZE];
+    oled_SetBackBuffer(oled, back);
+    oled_SetPenSize(oled, 0);
+    for (int i=0; i<3; i++){                            // frames redrawn in full
+        oled_Clear(oled);
+        oled_FillRect(oled, 4 + 40*i, 10, 43 + 40*i, 53);
+        oled_DrawRect(oled, 0, 0, 127, 63);
+        oled_Present(oled);
+    }
+    oled_FillRect(oled, 100, 2, 120, 5);                // top page, drawn over the frame before the one presented
+    oled_SetBackBuffer(oled, NULL);
+    oled_SetRasterOp(oled, OLED_ROP_XOR);
+    oled_FillCircle(oled, 100, 32, 8);
+    oled_FlushRect(oled, 92, 24, 108, 40);
+    while (oled_IsBusy(oled));                          // sent on its own
+    oled_DrawLine(oled, 0, 63, 127, 0);
+    oled_SetRasterOp(oled, OLED_ROP_COPY);
+}
+
+//========================================
+// scene_Text()
+// the text of DemoText()
+//========================================
+void scene_Text(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_DispString(oled, 0, 0, "WELCOME\nTO\nELECTRONIX\nFIRST");
+}
+
+//========================================
+// scene_TextFill()
+// text with a filled background over a
+// pattern, not aligned to pages, partly off
+// the display, cleared with the size given by
+// oled_MeasureString() and highlighted with
+// oled_InvertRect()
+//========================================
+void scene_TextFill(oled_t * oled)
+{
+    int width, height;
+    oled_Clear(oled);
+    oled_SetPenSize(oled, 0);
+    for (int x=0; x<OLED_WIDTH; x+=4) oled_DrawLine(oled, x, 0, OLED_WIDTH - 1 - x, OLED_HEIGHT - 1);
+    oled_MeasureString(oled, "OLD TEXT\n1234", &width, &height);
+    oled_ClearRect(oled, 4, 3, 4 + width - 1, 3 + height - 1);
+    oled_SetTextMode(oled, OLED_TEXT_FILL);
+    oled_DispString(oled, 4, 3, "Fill\nmode");
+    oled_SetTextMode(oled, OLED_TEXT_TRAN);
+    oled_DispString(oled, 90, 45, "Tran~");
+    oled_InvertRect(oled, 86, 43, 140, 55);             // highlighted, partly off the display
+}
+
+//========================================
+// scene_TextProp()
+// the text of DemoText() in the proportional
+// font, not aligned to pages
+//========================================
+void scene_TextProp(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_SetFont(oled, &fontProp);
+    oled_DispString(oled, 0, 3, "WELCOME TO\nElectronix, first!\n{1234567890}");
+    oled_SetFont(oled, &font);
+}
+
+//========================================
+// scene_Fonts()
+// the font family: a status bar in the 6x8
+// fonts over text in the 8x16 and 16x24 fonts
+//========================================
+void scene_Fonts(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_SetFont(oled, &font6x8);
+    oled_DispString(oled, 0, 0, "12:34  BAT 87%  RX:ok");
+    oled_SetFont(oled, &font6x8Prop);
+    oled_DispString(oled, 0, 9, "Proportional 6x8: Wiggly, 100%");
+    oled_SetFont(oled, &font8x16RLE);
+    oled_DispString(oled, 0, 18, "8x16 {Font}");
+    oled_SetFont(oled, &font16x24);
+    oled_DispString(oled, 0, 37, "16x24");
+    oled_SetFont(oled, &font6x8RLE);
+    oled_DispString(oled, 86, 44, "6x8 RLE\nunder");
+    oled_SetFont(oled, &font);
+}
+
+//========================================
+// scene_Bitmap()
+// the bitmap of DemoBitmap()
+//========================================
+void scene_Bitmap(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_DispBitmap(oled, 32, 13, MIT_xbm, MIT_WIDTH, MIT_HEIGHT);
+}
+
+//========================================
+// scene_PageBitmap()
+// the bitmap of DemoBitmap() in GRAM format
+//========================================
+void scene_PageBitmap(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_DispPageBitmap(oled, 32, 13, MIT_page, MIT_WIDTH, MIT_HEIGHT);
+}
+
+//========================================
+// scene_RLE()
+// the bitmap of DemoBitmap() and text, both
+// compressed, not aligned to pages and 
+// partly off the display
+//========================================
+void scene_RLE(oled_t * oled)
+{
+    oled_Clear(oled);
+    oled_DispRLEBitmap(oled, 70, 29, MIT_compressed, MIT_WIDTH, MIT_HEIGHT);
+    oled_DispRLEBitmap(oled, -20, -11, MIT_compressed, MIT_WIDTH, MIT_HEIGHT);
+    oled_SetFont(oled, &fontPropRLE);
+    oled_DispString(oled, 46, 5, "RLE text\nok?");
+    oled_SetFont(oled, &font12x16RLE);
+    oled_SetTextMode(oled, OLED_TEXT_FILL);
+    oled_DispString(oled, -5, 44, "Zip|");
+    oled_SetTextMode(oled, OLED_TEXT_TRAN);
+    oled_SetFont(oled, &font);
+}
+
+//========================================
+// END OF FILE
+//========================================
@@ -0,0 +1,48 @@
+#ifndef _SCENES_H
+#define _SCENES_H
+
+//======================================
+// include
+//======================================
+#include "oled.h"
+
+//======================================
+// MIT logo from main.c (64 x 38)
+//======================================
+#define MIT_WIDTH 64
+#define MIT_HEIGHT 38
+extern const unsigned char * MIT_xbm;       // .xbm format
+extern const unsigned char * MIT_page;      // GRAM format
+extern const unsigned char * MIT_compressed;  // compressed GRAM format
+
+//======================================
+// compressed proportional font (fonts_rle.c,
+// generated by font2page)
+//======================================
+extern const font_t fontPropRLE;            // fontProp, compressed
+
+//======================================
+// scenes: the demos of main.c drawn as
+// single frames
+//======================================
+void scene_Graphics(oled_t * oled);
+void scene_Gauges(oled_t * oled);
+void scene_Angles(oled_t * oled);
+void scene_RasterOps(oled_t * oled);
+void scene_Viewports(oled_t * oled);
+void scene_Polygons(oled_t * oled);
+void scene_Ellipses(oled_t * oled);
+void scene_BackBuffer(oled_t * oled);
+void scene_Text(oled_t * oled);
+void scene_TextFill(oled_t * oled);
+void scene_TextProp(oled_t * oled);
+void scene_Fonts(oled_t * oled);
+void scene_Bitmap(oled_t * oled);
+void scene_PageBitmap(oled_t * oled);
+void scene_RLE(oled_t * oled);
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
@@ -0,0 +1,244 @@
+//======================================
+// include
+//======================================
+#include <stdio.h>
+#include "ssd1306_emu.h"
+
+//======================================
+// private function declarations
+//======================================
+uint8 ParamCount(uint8 cmd);
+void ExecuteCmd(ssd1306_t * emu);
+void WriteRAM(ssd1306_t * emu, uint8 byte);
+
+//========================================
+// ssd1306_Init()
+// this function puts the emulator in its
+// power on reset state (RAM is not cleared
+// by the chip, the emulator fills it with 0x00)
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     slaveAddr - 7-bit I2C address to answer to
+//========================================
+void ssd1306_Init(ssd1306_t * emu, uint8 slaveAddr)
+{
+    for (int i=0; i<SSD1306_EMU_PAGES; i++){
+        for (int j=0; j<SSD1306_EMU_COLUMNS; j++){
+            emu->ram[i][j] = 0x00;
+        }
+    }
+    emu->mode = SSD1306_EMU_PAGE;                   // page addressing mode after reset
+    emu->colStart = 0;
+    emu->colEnd = SSD1306_EMU_COLUMNS - 1;
+    emu->pageStart = 0;
+    emu->pageEnd = SSD1306_EMU_PAGES - 1;
+    emu->col = 0;
+    emu->page = 0;
+    emu->cmdLen = 0;
+    emu->inTransfer = 0;
+    emu->expectControl = 0;
+    emu->continuation = 0;
+    emu->dataMode = 0;
+    emu->addressed = 0;
+    emu->slaveAddr = slaveAddr;
+    emu->errors = 0;
+}
+
+//========================================
+// ssd1306_Start()
+// this function receives an I2C Start condition
+// followed by the slave address byte
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     slaveAddr - 7-bit I2C address
+//     R_nW - read/write bit (only writes are emulated)
+//========================================
+void ssd1306_Start(ssd1306_t * emu, uint8 slaveAddr, uint8 R_nW)
+{
+    emu->inTransfer = 1;                            // a repeated Start also begins a new transfer
+    emu->addressed = (slaveAddr == emu->slaveAddr);
+    if (emu->addressed && (R_nW != 0)) emu->errors++;   // status reads are not emulated
+    emu->expectControl = 1;                         // every transfer begins with a control byte
+}
+
+//========================================
+// ssd1306_Write()
+// this function receives one byte of an I2C
+// write transfer: a control byte, a command
+// (or command parameter) or GRAM data, as
+// decided by the control byte before it
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     byte - byte received
+//========================================
+void ssd1306_Write(ssd1306_t * emu, uint8 byte)
+{
+    if (!emu->inTransfer){                          // byte without a Start condition
+        emu->errors++;
+        return;
+    }
+    if (!emu->addressed) return;                    // transfer for another slave
+    if (emu->expectControl){
+        if (byte & 0x3F) emu->errors++;             // the lower 6 bits of a control byte must be 0
+        emu->continuation = (byte >> 7) & 0x01;     // Co bit
+        emu->dataMode = (byte >> 6) & 0x01;         // D/C# bit
+        emu->expectControl = 0;
+        return;
+    }
+    if (emu->dataMode){
+        WriteRAM(emu, byte);
+    }
+    else {
+        emu->cmd[emu->cmdLen++] = byte;             // parameters may arrive with their own control bytes
+        if (emu->cmdLen > ParamCount(emu->cmd[0])){
+            ExecuteCmd(emu);
+            emu->cmdLen = 0;
+        }
+    }
+    if (emu->continuation) emu->expectControl = 1;  // Co = 1: a control byte follows every data/command byte
+}
+
+//========================================
+// ssd1306_Stop()
+// this function receives an I2C Stop condition
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//========================================
+void ssd1306_Stop(ssd1306_t * emu)
+{
+    emu->inTransfer = 0;
+    emu->addressed = 0;
+}
+
+//========================================
+// ssd1306_WritePBM()
+// this function saves display RAM as a plain
+// (P1) PBM image, 1 = pixel on
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     path - name of the file to write
+//
+// Returns:
+//     0 on success, -1 if the file could not be written
+//========================================
+int ssd1306_WritePBM(const ssd1306_t * emu, const char * path)
+{
+    FILE * f = fopen(path, "w");
+    if (f == NULL) return -1;
+    fprintf(f, "P1\n%d %d\n", SSD1306_EMU_COLUMNS, SSD1306_EMU_PAGES*8);
+    for (int y=0; y<SSD1306_EMU_PAGES*8; y++){
+        for (int x=0; x<SSD1306_EMU_COLUMNS; x++){
+            fputc((emu->ram[y/8][x] >> (y%8)) & 0x01 ? '1' : '0', f);
+            fputc(x%32 == 31 ? '\n' : ' ', f);     // 32 pixels per line (PBM lines are at most 70 characters)
+        }
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+//======================================
+// ParamCount()
+// this function returns the number of
+// parameter bytes that follow a command
+//
+// Parameters:
+//     cmd - first byte of the command
+//======================================
+uint8 ParamCount(uint8 cmd)
+{
+    switch (cmd){
+        case 0x26: case 0x27:                       // horizontal scroll setup
+            return 6;
+        case 0x29: case 0x2A:                       // continuous vertical and horizontal scroll setup
+            return 5;
+        case 0x21: case 0x22: case 0xA3:            // column address, page address, vertical scroll area
+            return 2;
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+//======================================
+// ExecuteCmd()
+// this function carries out a complete command
+// (only the ones that affect how display RAM
+// is addressed; the others are accepted and
+// ignored)
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//======================================
+void ExecuteCmd(ssd1306_t * emu)
+{
+    uint8 c = emu->cmd[0];
+    if (c == 0x20){                                 // Set Memory Addressing Mode
+        if ((emu->cmd[1] & 0x03) != 0x03) emu->mode = emu->cmd[1] & 0x03;
+        else emu->errors++;                         // invalid mode
+    }
+    else if (c == 0x21){                            // Set Column Address
+        emu->colStart = emu->cmd[1] & 0x7F;
+        emu->colEnd = emu->cmd[2] & 0x7F;
+        emu->col = emu->colStart;
+    }
+    else if (c == 0x22){                            // Set Page Address
+        emu->pageStart = emu->cmd[1] & 0x07;
+        emu->pageEnd = emu->cmd[2] & 0x07;
+        emu->page = emu->pageStart;
+    }
+    else if (c <= 0x0F){                            // Set Lower Column Start Address (page addressing)
+        emu->col = (emu->col & 0x70) | c;
+    }
+    else if (c <= 0x1F){                            // Set Higher Column Start Address (page addressing)
+        emu->col = ((c & 0x07) << 4) | (emu->col & 0x0F);
+    }
+    else if ((c & 0xF8) == 0xB0){                   // Set Page Start Address (page addressing)
+        emu->page = c & 0x07;
+    }
+}
+
+//======================================
+// WriteRAM()
+// this function writes one byte of GRAM data
+// at the RAM pointer and advances the pointer
+// as the addressing mode dictates
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     byte - GRAM data
+//======================================
+void WriteRAM(ssd1306_t * emu, uint8 byte)
+{
+    emu->ram[emu->page][emu->col] = byte;
+    if (emu->mode == SSD1306_EMU_HORIZONTAL){
+        if (emu->col == emu->colEnd){               // end of the window's columns: next page
+            emu->col = emu->colStart;
+            emu->page = (emu->page == emu->pageEnd) ? emu->pageStart : (emu->page + 1) & 0x07;
+        }
+        else {
+            emu->col = (emu->col + 1) & 0x7F;
+        }
+    }
+    else if (emu->mode == SSD1306_EMU_VERTICAL){
+        if (emu->page == emu->pageEnd){             // end of the window's pages: next column
+            emu->page = emu->pageStart;
+            emu->col = (emu->col == emu->colEnd) ? emu->colStart : (emu->col + 1) & 0x7F;
+        }
+        else {
+            emu->page = (emu->page + 1) & 0x07;
+        }
+    }
+    else {
+        emu->col = (emu->col + 1) & 0x7F;           // page addressing: the pointer stays on the page
+    }
+}
+
+//========================================
+// END OF FILE
+//========================================
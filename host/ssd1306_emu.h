@@ -0,0 +1,106 @@
+#ifndef _SSD1306_EMU_H
+#define _SSD1306_EMU_H
+
+//======================================
+// include
+//======================================
+#include "project.h"
+
+//======================================
+// emulator dimensions
+//======================================
+#define SSD1306_EMU_COLUMNS 128     // columns of display RAM
+#define SSD1306_EMU_PAGES 8         // pages (8 rows each) of display RAM
+
+//======================================
+// addressing modes
+//======================================
+#define SSD1306_EMU_HORIZONTAL 0x00     // column pointer wraps to the next page at the end of the window
+#define SSD1306_EMU_VERTICAL 0x01       // page pointer wraps to the next column at the end of the window
+#define SSD1306_EMU_PAGE 0x02           // column pointer stays on the page (wraps to the page's start column)
+
+//======================================
+// emulator struct
+//======================================
+typedef struct {
+    uint8 ram[SSD1306_EMU_PAGES][SSD1306_EMU_COLUMNS];  // display RAM (GDDRAM), bit 0 of each byte is the top row of the page
+    uint8 mode;                                         // addressing mode
+    uint8 colStart, colEnd;                             // column window (horizontal and vertical addressing)
+    uint8 pageStart, pageEnd;                           // page window (horizontal and vertical addressing)
+    uint8 col, page;                                    // RAM pointer
+    uint8 cmd[8];                                       // command being received and its parameters
+    uint8 cmdLen;                                       // bytes of cmd received so far
+    uint8 inTransfer;                                   // 1 between Start and Stop conditions
+    uint8 expectControl;                                // 1 if the next byte is a control byte
+    uint8 continuation;                                 // Co bit of the last control byte (0: only data bytes follow)
+    uint8 dataMode;                                     // D/C# bit of the last control byte (1: GRAM data)
+    uint8 addressed;                                    // 1 if the current transfer is addressed to this display
+    uint8 slaveAddr;                                    // 7-bit I2C address the emulator answers to
+    uint32 errors;                                      // bytes the emulator could not make sense of
+} ssd1306_t;
+
+//========================================
+// ssd1306_Init()
+// this function puts the emulator in its
+// power on reset state (RAM is not cleared
+// by the chip, the emulator fills it with 0x00)
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     slaveAddr - 7-bit I2C address to answer to
+//========================================
+void ssd1306_Init(ssd1306_t * emu, uint8 slaveAddr);
+
+//========================================
+// ssd1306_Start()
+// this function receives an I2C Start condition
+// followed by the slave address byte
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     slaveAddr - 7-bit I2C address
+//     R_nW - read/write bit (only writes are emulated)
+//========================================
+void ssd1306_Start(ssd1306_t * emu, uint8 slaveAddr, uint8 R_nW);
+
+//========================================
+// ssd1306_Write()
+// this function receives one byte of an I2C
+// write transfer: a control byte, a command
+// (or command parameter) or GRAM data, as
+// decided by the control byte before it
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     byte - byte received
+//========================================
+void ssd1306_Write(ssd1306_t * emu, uint8 byte);
+
+//========================================
+// ssd1306_Stop()
+// this function receives an I2C Stop condition
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//========================================
+void ssd1306_Stop(ssd1306_t * emu);
+
+//========================================
+// ssd1306_WritePBM()
+// this function saves display RAM as a plain
+// (P1) PBM image, 1 = pixel on
+//
+// Parameters:
+//     emu - pointer to a ssd1306_t structure
+//     path - name of the file to write
+//
+// Returns:
+//     0 on success, -1 if the file could not be written
+//========================================
+int ssd1306_WritePBM(const ssd1306_t * emu, const char * path);
+
+#endif
+
+//========================================
+// END OF FILE
+//========================================
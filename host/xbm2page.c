@@ -0,0 +1,133 @@
+//======================================
+// include
+//======================================
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rle.h"
+
+//======================================
+// xbm2page
+// converts .xbm images (rows of pixels, bit 0
+// = leftmost pixel) into C arrays in GRAM format
+// for oled_DispPageBitmap(): (height+7)/8 pages,
+// each page one byte per column, bit 0 = top pixel
+//
+// usage: xbm2page [-r] file.xbm [name] > file.h
+// name defaults to the file name without its
+// extension (prefixed with "xbm_" if it does not
+// start with a letter). With -r the bitmap is
+// compressed, for oled_DispRLEBitmap(), into
+// the array name_rle
+//======================================
+
+#define MAX_BYTES 65536
+
+//========================================
+// ReadXBM()
+// this function reads the width, height and
+// pixel bytes of an .xbm file
+//
+// Returns:
+//     number of pixel bytes, or -1 on error
+//========================================
+int ReadXBM(const char * path, int * width, int * height, unsigned char * bits)
+{
+    static char text[8*MAX_BYTES];
+    FILE * f = fopen(path, "r");
+    if (f == NULL) return -1;
+    size_t len = fread(text, 1, sizeof(text) - 1, f);
+    fclose(f);
+    text[len] = '\0';
+
+    char * w = strstr(text, "_width");              // "#define name_width 12"
+    char * h = strstr(text, "_height");
+    char * c = strchr(text, '{');                   // start of the pixel bytes
+    if ((w == NULL) || (h == NULL) || (c == NULL)) return -1;
+    *width = atoi(w + 6);
+    *height = atoi(h + 7);
+
+    int n = 0;
+    while (((c = strstr(c, "0x")) != NULL) && (n < MAX_BYTES)){
+        bits[n++] = (unsigned char)strtol(c, &c, 16);
+    }
+    if ((*width <= 0) || (*height <= 0) || (n < ((*width + 7)/8)*(*height))) return -1;
+    return n;
+}
+
+//========================================
+// main
+//========================================
+int main(int argc, char ** argv)
+{
+    static unsigned char bits[MAX_BYTES];
+    static unsigned char page[MAX_BYTES];
+    static unsigned char rle[MAX_BYTES + MAX_BYTES/128 + 1];
+    int width, height;
+    char name[256];
+
+    int compress = (argc > 1) && (strcmp(argv[1], "-r") == 0);
+    argc -= compress;
+    argv += compress;
+    if ((argc < 2) || (argc > 3)){
+        fprintf(stderr, "usage: xbm2page [-r] file.xbm [name]\n");
+        return 2;
+    }
+    if (ReadXBM(argv[1], &width, &height, bits) < 0){
+        fprintf(stderr, "xbm2page: could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    if (argc == 3){
+        snprintf(name, sizeof(name), "%s", argv[2]);
+    }
+    else {                                          // file name without directory and extension
+        const char * base = strrchr(argv[1], '/');
+        base = (base == NULL) ? argv[1] : base + 1;
+        snprintf(name, sizeof(name), "%s%s", isalpha((unsigned char)base[0]) ? "" : "xbm_", base);
+        char * dot = strrchr(name, '.');
+        if (dot != NULL) *dot = '\0';
+        for (char * c=name; *c; c++){
+            if (!isalnum((unsigned char)*c)) *c = '_';
+        }
+    }
+
+    int stride = (width + 7)/8;
+    int pages = (height + 7)/8;
+    int n = pages*width;
+    if (n > MAX_BYTES){
+        fprintf(stderr, "xbm2page: %s is too large\n", argv[1]);
+        return 1;
+    }
+    for (int p=0; p<pages; p++){
+        for (int x=0; x<width; x++){
+            unsigned char col = 0;
+            for (int k=0; k<8; k++){                // gather the 8 rows of the page in this column
+                int y = 8*p + k;
+                if (y >= height) break;
+                col |= ((bits[y*stride + x/8] >> (x%8)) & 0x01) << k;
+            }
+            page[p*width + x] = col;
+        }
+    }
+    const unsigned char * out = page;
+    if (compress){
+        n = rle_Encode(page, n, rle);
+        out = rle;
+    }
+
+    printf("// %s converted by xbm2page (%s)\n", argv[1], compress ? "compressed GRAM format, for oled_DispRLEBitmap()" : "GRAM format, for oled_DispPageBitmap()");
+    printf("#define %s_width %d\n", name, width);
+    printf("#define %s_height %d\n", name, height);
+    printf("static const unsigned char %s_%s[] = {", name, compress ? "rle" : "pages");
+    for (int i=0; i<n; i++){
+        printf("%s0x%02x", (i == 0) ? "\n   " : (i % 12 == 0 ? ",\n   " : ", "), out[i]);
+    }
+    printf(" };\n");
+    return 0;
+}
+
+//========================================
+// END OF FILE
+//========================================